@@ -264,7 +264,7 @@ namespace Olympe
 
         if (componentType == "Position_data" && world.HasComponent<Position_data>(entity))
         {
-            auto& comp = world.GetComponent<Position_data>(entity);
+            auto& comp = world.Modify<Position_data>(entity);
             
             try
             {
@@ -362,13 +362,9 @@ namespace Olympe
     {
         World& world = World::Get();
 
-        // Get all entities from World
-        const auto& entitySignatures = world.m_entitySignatures;
-
         // Add any entities we don't have
-        for (const auto& pair : entitySignatures)
+        for (EntityID entity : world.GetAllEntities())
         {
-            EntityID entity = pair.first;
             
             if (std::find(m_EntityList.begin(), m_EntityList.end(), entity) == m_EntityList.end())
             {
@@ -381,7 +377,7 @@ namespace Olympe
             info.componentTypes.clear();
 
             // Extract component types from signature
-            const ComponentSignature& sig = pair.second;
+            const ComponentSignature& sig = world.GetEntitySignature(entity);
             
             // Check each component type
             // This is a simplified approach - ideally you'd have a component type registry
@@ -405,9 +401,9 @@ namespace Olympe
         // Remove entities that no longer exist in World
         m_EntityList.erase(
             std::remove_if(m_EntityList.begin(), m_EntityList.end(),
-                [&entitySignatures](EntityID entity)
+                [&world](EntityID entity)
                 {
-                    return entitySignatures.find(entity) == entitySignatures.end();
+                    return !world.IsEntityValid(entity);
                 }),
             m_EntityList.end()
         );
@@ -0,0 +1,312 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+CollisionBenchmark: broad-phase backends on synthetic proxy distributions.
+
+For each distribution (uniform scatter, crowd sharing an x range, sparse line, mixed sizes)
+the benchmark computes the proxy distribution statistics, the backend they select
+(Collision_SelectBroadPhaseBackend), then times every backend on the same moving proxies:
+full-sort sweep-and-prune, spatial hash (levels from Collision_MakeSpatialHashConfig),
+incremental sweep-and-prune and, below 4000 proxies, brute force. All backends must give
+the same pairs; the selected backend is marked with '*'.
+
+Build: console target with the Source/CollisionSystems sources (no SDL window, no World).
+
+Usage:
+    CollisionBenchmark [--proxies <n>] [--frames <n>] [--scene scatter|crowd|line|mixed]
+    Without --scene, every distribution is run.
+    Exit code: 0 = ok, 1 = bad arguments, 2 = backends disagree on the pairs.
+*/
+
+#include "../CollisionSystems/Collision_BroadPhase.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    enum class Scene
+    {
+        Scatter,
+        Crowd,
+        Line,
+        Mixed
+    };
+
+    const Scene k_AllScenes[] = { Scene::Scatter, Scene::Crowd, Scene::Line, Scene::Mixed };
+
+    const char* GetSceneName(Scene scene)
+    {
+        switch (scene)
+        {
+        case Scene::Scatter: return "scatter";
+        case Scene::Crowd:   return "crowd";
+        case Scene::Line:    return "line";
+        case Scene::Mixed:   return "mixed";
+        }
+        return "?";
+    }
+
+    struct Options
+    {
+        int proxies = 2000;
+        int frames = 60;
+        int scene = -1;             // Index in k_AllScenes, -1 = every scene
+    };
+
+    // Sum over the frames of one backend
+    struct BackendResult
+    {
+        const char* name = "";
+        double elapsedMs = 0.0;
+        size_t comparisons = 0;
+        size_t maxActiveCount = 0;
+        size_t pairs = 0;
+        bool selected = false;
+    };
+
+    void PrintUsage()
+    {
+        std::printf("Usage: CollisionBenchmark [--proxies <n>] [--frames <n>] [--scene scatter|crowd|line|mixed]\n");
+    }
+
+    bool ParseOptions(int argc, char* argv[], Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+            if (!value)
+                return false;
+
+            if (arg == "--proxies") options.proxies = std::atoi(value);
+            else if (arg == "--frames") options.frames = std::atoi(value);
+            else if (arg == "--scene")
+            {
+                options.scene = -1;
+                for (int s = 0; s < 4; ++s)
+                {
+                    if (std::strcmp(value, GetSceneName(k_AllScenes[s])) == 0)
+                        options.scene = s;
+                }
+                if (options.scene < 0)
+                    return false;
+            }
+            else
+            {
+                return false;
+            }
+            ++i;
+        }
+        return options.proxies > 0 && options.frames > 0;
+    }
+
+    // Deterministic pseudo-random values in [0, 1)
+    float NextUnit(unsigned int& state)
+    {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 16777216.0f;
+    }
+
+    Olympe::Collision_AABB MakeBox(float x, float y, float w, float h)
+    {
+        Olympe::Collision_AABB box;
+        box.min.x = x;
+        box.min.y = y;
+        box.min.z = 0.0f;
+        box.max.x = x + w;
+        box.max.y = y + h;
+        box.max.z = 0.0f;
+        return box;
+    }
+
+    // Same density of 32-unit boxes for every count (about 4% of the area covered)
+    void BuildScene(Scene scene, int count, std::vector<Olympe::Collision_SpatialProxy>& proxies)
+    {
+        unsigned int state = 1234u;
+        const float side = 32.0f * std::sqrt(static_cast<float>(count) * 25.0f);
+
+        proxies.clear();
+        for (int i = 0; i < count; ++i)
+        {
+            Olympe::Collision_SpatialProxy proxy;
+            proxy.entity = static_cast<EntityID>(i + 1);
+
+            const float u = NextUnit(state);
+            const float v = NextUnit(state);
+            switch (scene)
+            {
+            case Scene::Scatter:
+                proxy.worldAABB = MakeBox(u * side, v * side, 32.0f, 32.0f);
+                break;
+            case Scene::Crowd:
+                // Everybody in a corridor a few boxes wide
+                proxy.worldAABB = MakeBox(u * 160.0f, v * side * 5.0f, 32.0f, 32.0f);
+                break;
+            case Scene::Line:
+                proxy.worldAABB = MakeBox(i * 48.0f + u * 8.0f, v * 64.0f, 32.0f, 32.0f);
+                break;
+            case Scene::Mixed:
+            {
+                const float size = ((i % 50) == 0) ? 256.0f + u * 512.0f : 16.0f + u * 32.0f;
+                proxy.worldAABB = MakeBox(NextUnit(state) * side, v * side, size, size * 0.75f);
+                break;
+            }
+            }
+            proxies.push_back(proxy);
+        }
+    }
+
+    // Small random walk, as entities do between two frames
+    void MoveProxies(std::vector<Olympe::Collision_SpatialProxy>& proxies, unsigned int& state)
+    {
+        for (Olympe::Collision_SpatialProxy& proxy : proxies)
+        {
+            const float dx = (NextUnit(state) - 0.5f) * 8.0f;
+            const float dy = (NextUnit(state) - 0.5f) * 8.0f;
+            proxy.worldAABB.min.x += dx;
+            proxy.worldAABB.max.x += dx;
+            proxy.worldAABB.min.y += dy;
+            proxy.worldAABB.max.y += dy;
+        }
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Wall time of the whole call: metrics.elapsedMs leaves out the SAP's initial sort
+    void Accumulate(BackendResult& result, const Olympe::Collision_BroadPhaseMetrics& metrics, double elapsedMs)
+    {
+        result.elapsedMs += elapsedMs;
+        result.comparisons += metrics.comparisons;
+        if (metrics.maxActiveCount > result.maxActiveCount)
+            result.maxActiveCount = metrics.maxActiveCount;
+        result.pairs += metrics.pairsAfterDedup;
+    }
+
+    bool SamePairs(const std::vector<Olympe::Collision_CandidatePair>& lhs, const std::vector<Olympe::Collision_CandidatePair>& rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (lhs[i].a != rhs[i].a || lhs[i].b != rhs[i].b)
+                return false;
+        }
+        return true;
+    }
+
+    // Returns false when a backend disagrees with the full-sort SAP
+    bool RunScene(Scene scene, const Options& options)
+    {
+        std::vector<Olympe::Collision_SpatialProxy> proxies;
+        BuildScene(scene, options.proxies, proxies);
+
+        Olympe::Collision_BroadPhaseScratch scratch;
+        Olympe::Collision_ProxyDistributionStats stats;
+        Olympe::Collision_ComputeProxyDistributionStats(proxies, stats, scratch);
+        const Olympe::Collision_BroadPhaseBackend selected = Olympe::Collision_SelectBroadPhaseBackend(stats);
+        const Olympe::Collision_SpatialHashConfig config = Olympe::Collision_MakeSpatialHashConfig(stats);
+
+        std::printf("\n[CollisionBenchmark] scene=%s proxies=%d frames=%d\n", GetSceneName(scene), options.proxies, options.frames);
+        std::printf("mean width %.1f, mean extent %.1f, max extent %.1f, sweep neighbours %.2f, cell neighbours %.2f, grid levels %u\n",
+                    stats.meanWidth, stats.meanExtent, stats.maxExtent, stats.sweepNeighbours, stats.cellNeighbours,
+                    static_cast<unsigned int>(config.cellSizes.size()));
+
+        const bool runBruteForce = options.proxies < 4000;
+        BackendResult sap, hash, incremental, brute;
+        sap.name = "sap";
+        sap.selected = (selected == Olympe::Collision_BroadPhaseBackend::SweepAndPrune);
+        hash.name = "hash";
+        hash.selected = (selected == Olympe::Collision_BroadPhaseBackend::SpatialHash);
+        incremental.name = "sap-incr";
+        brute.name = "brute";
+
+        Olympe::Collision_IncrementalSweepAndPrune persistent;
+        std::vector<Olympe::Collision_CandidatePair> sapPairs, otherPairs, added, removed;
+        Olympe::Collision_BroadPhaseMetrics metrics;
+        unsigned int state = 99u;
+        bool agree = true;
+
+        for (int frame = 0; frame < options.frames; ++frame)
+        {
+            MoveProxies(proxies, state);
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            Olympe::Collision_ComputeBroadPhasePairs(proxies, sapPairs, scratch, &metrics, Olympe::Collision_BroadPhaseFilter());
+            Accumulate(sap, metrics, ElapsedMs(start));
+
+            start = std::chrono::steady_clock::now();
+            Olympe::Collision_ComputeBroadPhasePairsSpatialHash(proxies, otherPairs, scratch, &metrics, Olympe::Collision_BroadPhaseFilter(), config);
+            Accumulate(hash, metrics, ElapsedMs(start));
+            agree = agree && SamePairs(sapPairs, otherPairs);
+
+            start = std::chrono::steady_clock::now();
+            for (const Olympe::Collision_SpatialProxy& proxy : proxies)
+                persistent.SetProxy(proxy.entity, proxy.worldAABB);
+            persistent.Update(added, removed, &metrics, Olympe::Collision_BroadPhaseFilter());
+            // The first frame inserts everything: not representative of the steady state
+            if (frame > 0)
+                Accumulate(incremental, metrics, ElapsedMs(start));
+            persistent.GetPairs(otherPairs);
+            agree = agree && SamePairs(sapPairs, otherPairs);
+
+            if (runBruteForce)
+            {
+                start = std::chrono::steady_clock::now();
+                Olympe::Collision_ComputeBroadPhasePairsBruteForce(proxies, otherPairs, scratch, &metrics, Olympe::Collision_BroadPhaseFilter());
+                Accumulate(brute, metrics, ElapsedMs(start));
+                agree = agree && SamePairs(sapPairs, otherPairs);
+            }
+        }
+
+        std::printf("backend     ms/frame  comparisons/frame  max active  pairs/frame\n");
+        const BackendResult* results[] = { &sap, &hash, &incremental, &brute };
+        for (const BackendResult* result : results)
+        {
+            if (result == &brute && !runBruteForce)
+                continue;
+            const int frames = (result == &incremental) ? options.frames - 1 : options.frames;
+            if (frames <= 0)
+                continue;
+            std::printf("%c%-9s %9.4f %18.0f %11u %12.1f\n", result->selected ? '*' : ' ', result->name,
+                        result->elapsedMs / frames, static_cast<double>(result->comparisons) / frames,
+                        static_cast<unsigned int>(result->maxActiveCount), static_cast<double>(result->pairs) / frames);
+        }
+
+        if (!agree)
+            std::printf("[CollisionBenchmark] Backends disagree on the pairs\n");
+        return agree;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    bool agree = true;
+    for (int s = 0; s < 4; ++s)
+    {
+        if (options.scene >= 0 && options.scene != s)
+            continue;
+        agree = RunScene(k_AllScenes[s], options) && agree;
+    }
+
+    return agree ? 0 : 2;
+}
@@ -0,0 +1,529 @@
+#include "Collision_BatchIntersections.h"
+
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OLYMPE_COLLISION_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Olympe {
+
+// Same constant and helpers as Collision_Intersections.cpp: the scalar tail must match it.
+// _mm_max_ps(a, b) / _mm_min_ps(a, b) return (a > b) ? a : b / (a < b) ? a : b, as these do.
+static const float COLLISION_EPSILON = 0.0001f;
+
+static float Collision_Max(float a, float b)
+{
+    return (a > b) ? a : b;
+}
+
+static float Collision_Min(float a, float b)
+{
+    return (a < b) ? a : b;
+}
+
+static float Collision_Clamp(float value, float minVal, float maxVal)
+{
+    return Collision_Max(minVal, Collision_Min(value, maxVal));
+}
+
+// Collision_IsValidAABB without the log: batch queries may be rejected every frame
+static bool Collision_IsOrderedAABB(const Collision_AABB& box)
+{
+    return box.min.x <= box.max.x && box.min.y <= box.max.y && box.min.z <= box.max.z;
+}
+
+static size_t Collision_CountBits(unsigned int bits)
+{
+    size_t count = 0;
+    while (bits)
+    {
+        bits &= bits - 1;
+        ++count;
+    }
+    return count;
+}
+
+static void Collision_SetMaskBits(uint64_t* outMask, size_t index, unsigned int bits)
+{
+    // Lane groups start on a multiple of their width: they never straddle two words
+    outMask[index / 64] |= static_cast<uint64_t>(bits) << (index % 64);
+}
+
+// Clears the outputs; returns false when there is nothing to test
+static bool Collision_BeginBatch(size_t count, bool validQuery, uint64_t* outMask, float* outPenetration)
+{
+    const size_t words = Collision_BatchMaskWordCount(count);
+    size_t w = 0;
+    for (; w < words; ++w)
+    {
+        outMask[w] = 0;
+    }
+
+    if (!validQuery && outPenetration)
+    {
+        size_t i = 0;
+        for (; i < count; ++i)
+        {
+            outPenetration[i] = 0.0f;
+        }
+    }
+
+    return validQuery && count > 0;
+}
+
+void Collision_PackedAABBs::Clear()
+{
+    minX.clear();
+    minY.clear();
+    maxX.clear();
+    maxY.clear();
+}
+
+void Collision_PackedAABBs::Reserve(size_t count)
+{
+    minX.reserve(count);
+    minY.reserve(count);
+    maxX.reserve(count);
+    maxY.reserve(count);
+}
+
+void Collision_PackedAABBs::Push(const Collision_AABB& box)
+{
+    if (!Collision_IsOrderedAABB(box))
+    {
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        minX.push_back(nan);
+        minY.push_back(nan);
+        maxX.push_back(nan);
+        maxY.push_back(nan);
+        return;
+    }
+
+    minX.push_back(box.min.x);
+    minY.push_back(box.min.y);
+    maxX.push_back(box.max.x);
+    maxY.push_back(box.max.y);
+}
+
+void Collision_PackedCircles::Clear()
+{
+    centerX.clear();
+    centerY.clear();
+    radius.clear();
+}
+
+void Collision_PackedCircles::Reserve(size_t count)
+{
+    centerX.reserve(count);
+    centerY.reserve(count);
+    radius.reserve(count);
+}
+
+void Collision_PackedCircles::Push(const Collision_Circle& circle)
+{
+    centerX.push_back(circle.center.x);
+    centerY.push_back(circle.center.y);
+    radius.push_back((circle.radius < 0.0f) ? std::numeric_limits<float>::quiet_NaN() : circle.radius);
+}
+
+size_t Collision_BatchIntersects_AABBAABB(const Collision_AABB& query,
+                                          const Collision_PackedAABBs& boxes,
+                                          uint64_t* outMask,
+                                          float* outPenetration)
+{
+    const size_t count = boxes.Size();
+    if (!Collision_BeginBatch(count, Collision_IsOrderedAABB(query), outMask, outPenetration))
+    {
+        return 0;
+    }
+
+    const float* bMinX = &boxes.minX[0];
+    const float* bMinY = &boxes.minY[0];
+    const float* bMaxX = &boxes.maxX[0];
+    const float* bMaxY = &boxes.maxY[0];
+    const float aMaxXEps = query.max.x + COLLISION_EPSILON;
+    const float aMaxYEps = query.max.y + COLLISION_EPSILON;
+
+    size_t hits = 0;
+    size_t i = 0;
+#if defined(__AVX__)
+    {
+        const __m256 eps = _mm256_set1_ps(COLLISION_EPSILON);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 aMinX = _mm256_set1_ps(query.min.x);
+        const __m256 aMinY = _mm256_set1_ps(query.min.y);
+        const __m256 aMaxX = _mm256_set1_ps(query.max.x);
+        const __m256 aMaxY = _mm256_set1_ps(query.max.y);
+        const __m256 aMaxXE = _mm256_set1_ps(aMaxXEps);
+        const __m256 aMaxYE = _mm256_set1_ps(aMaxYEps);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 minX = _mm256_loadu_ps(bMinX + i);
+            const __m256 minY = _mm256_loadu_ps(bMinY + i);
+            const __m256 maxX = _mm256_loadu_ps(bMaxX + i);
+            const __m256 maxY = _mm256_loadu_ps(bMaxY + i);
+
+            const __m256 hit = _mm256_and_ps(
+                _mm256_and_ps(_mm256_cmp_ps(aMinX, _mm256_add_ps(maxX, eps), _CMP_LE_OQ), _mm256_cmp_ps(aMaxXE, minX, _CMP_GE_OQ)),
+                _mm256_and_ps(_mm256_cmp_ps(aMinY, _mm256_add_ps(maxY, eps), _CMP_LE_OQ), _mm256_cmp_ps(aMaxYE, minY, _CMP_GE_OQ)));
+            const unsigned int bits = static_cast<unsigned int>(_mm256_movemask_ps(hit));
+            Collision_SetMaskBits(outMask, i, bits);
+            hits += Collision_CountBits(bits);
+
+            if (outPenetration)
+            {
+                const __m256 penX = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(aMaxX, maxX), _mm256_max_ps(aMinX, minX)), zero);
+                const __m256 penY = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(aMaxY, maxY), _mm256_max_ps(aMinY, minY)), zero);
+                // min(penY, penX) = (penX <= penY) ? penX : penY
+                _mm256_storeu_ps(outPenetration + i, _mm256_and_ps(hit, _mm256_min_ps(penY, penX)));
+            }
+        }
+    }
+#endif
+#if defined(OLYMPE_COLLISION_SSE2)
+    {
+        const __m128 eps = _mm_set1_ps(COLLISION_EPSILON);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 aMinX = _mm_set1_ps(query.min.x);
+        const __m128 aMinY = _mm_set1_ps(query.min.y);
+        const __m128 aMaxX = _mm_set1_ps(query.max.x);
+        const __m128 aMaxY = _mm_set1_ps(query.max.y);
+        const __m128 aMaxXE = _mm_set1_ps(aMaxXEps);
+        const __m128 aMaxYE = _mm_set1_ps(aMaxYEps);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 minX = _mm_loadu_ps(bMinX + i);
+            const __m128 minY = _mm_loadu_ps(bMinY + i);
+            const __m128 maxX = _mm_loadu_ps(bMaxX + i);
+            const __m128 maxY = _mm_loadu_ps(bMaxY + i);
+
+            const __m128 hit = _mm_and_ps(
+                _mm_and_ps(_mm_cmple_ps(aMinX, _mm_add_ps(maxX, eps)), _mm_cmpge_ps(aMaxXE, minX)),
+                _mm_and_ps(_mm_cmple_ps(aMinY, _mm_add_ps(maxY, eps)), _mm_cmpge_ps(aMaxYE, minY)));
+            const unsigned int bits = static_cast<unsigned int>(_mm_movemask_ps(hit));
+            Collision_SetMaskBits(outMask, i, bits);
+            hits += Collision_CountBits(bits);
+
+            if (outPenetration)
+            {
+                const __m128 penX = _mm_max_ps(_mm_sub_ps(_mm_min_ps(aMaxX, maxX), _mm_max_ps(aMinX, minX)), zero);
+                const __m128 penY = _mm_max_ps(_mm_sub_ps(_mm_min_ps(aMaxY, maxY), _mm_max_ps(aMinY, minY)), zero);
+                _mm_storeu_ps(outPenetration + i, _mm_and_ps(hit, _mm_min_ps(penY, penX)));
+            }
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        const bool hit = (query.min.x <= bMaxX[i] + COLLISION_EPSILON) && (aMaxXEps >= bMinX[i]) &&
+                         (query.min.y <= bMaxY[i] + COLLISION_EPSILON) && (aMaxYEps >= bMinY[i]);
+        if (hit)
+        {
+            Collision_SetMaskBits(outMask, i, 1u);
+            ++hits;
+        }
+
+        if (outPenetration)
+        {
+            const float penX = Collision_Max(Collision_Min(query.max.x, bMaxX[i]) - Collision_Max(query.min.x, bMinX[i]), 0.0f);
+            const float penY = Collision_Max(Collision_Min(query.max.y, bMaxY[i]) - Collision_Max(query.min.y, bMinY[i]), 0.0f);
+            outPenetration[i] = hit ? ((penX <= penY) ? penX : penY) : 0.0f;
+        }
+    }
+
+    return hits;
+}
+
+size_t Collision_BatchIntersects_CircleAABB(const Collision_Circle& query,
+                                            const Collision_PackedAABBs& boxes,
+                                            uint64_t* outMask,
+                                            float* outPenetration)
+{
+    const size_t count = boxes.Size();
+    if (!Collision_BeginBatch(count, query.radius >= 0.0f, outMask, outPenetration))
+    {
+        return 0;
+    }
+
+    const float* bMinX = &boxes.minX[0];
+    const float* bMinY = &boxes.minY[0];
+    const float* bMaxX = &boxes.maxX[0];
+    const float* bMaxY = &boxes.maxY[0];
+    const float limit = (query.radius * query.radius) + COLLISION_EPSILON;
+
+    size_t hits = 0;
+    size_t i = 0;
+#if defined(__AVX__)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 cx = _mm256_set1_ps(query.center.x);
+        const __m256 cy = _mm256_set1_ps(query.center.y);
+        const __m256 r = _mm256_set1_ps(query.radius);
+        const __m256 lim = _mm256_set1_ps(limit);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 dx = _mm256_sub_ps(cx, _mm256_max_ps(_mm256_loadu_ps(bMinX + i), _mm256_min_ps(cx, _mm256_loadu_ps(bMaxX + i))));
+            const __m256 dy = _mm256_sub_ps(cy, _mm256_max_ps(_mm256_loadu_ps(bMinY + i), _mm256_min_ps(cy, _mm256_loadu_ps(bMaxY + i))));
+            const __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+            const __m256 hit = _mm256_cmp_ps(distSq, lim, _CMP_LE_OQ);
+            const unsigned int bits = static_cast<unsigned int>(_mm256_movemask_ps(hit));
+            Collision_SetMaskBits(outMask, i, bits);
+            hits += Collision_CountBits(bits);
+
+            if (outPenetration)
+            {
+                const __m256 pen = _mm256_max_ps(_mm256_sub_ps(r, _mm256_sqrt_ps(distSq)), zero);
+                _mm256_storeu_ps(outPenetration + i, _mm256_and_ps(hit, pen));
+            }
+        }
+    }
+#endif
+#if defined(OLYMPE_COLLISION_SSE2)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 cx = _mm_set1_ps(query.center.x);
+        const __m128 cy = _mm_set1_ps(query.center.y);
+        const __m128 r = _mm_set1_ps(query.radius);
+        const __m128 lim = _mm_set1_ps(limit);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 dx = _mm_sub_ps(cx, _mm_max_ps(_mm_loadu_ps(bMinX + i), _mm_min_ps(cx, _mm_loadu_ps(bMaxX + i))));
+            const __m128 dy = _mm_sub_ps(cy, _mm_max_ps(_mm_loadu_ps(bMinY + i), _mm_min_ps(cy, _mm_loadu_ps(bMaxY + i))));
+            const __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+            const __m128 hit = _mm_cmple_ps(distSq, lim);
+            const unsigned int bits = static_cast<unsigned int>(_mm_movemask_ps(hit));
+            Collision_SetMaskBits(outMask, i, bits);
+            hits += Collision_CountBits(bits);
+
+            if (outPenetration)
+            {
+                const __m128 pen = _mm_max_ps(_mm_sub_ps(r, _mm_sqrt_ps(distSq)), zero);
+                _mm_storeu_ps(outPenetration + i, _mm_and_ps(hit, pen));
+            }
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        const float dx = query.center.x - Collision_Clamp(query.center.x, bMinX[i], bMaxX[i]);
+        const float dy = query.center.y - Collision_Clamp(query.center.y, bMinY[i], bMaxY[i]);
+        const float distSq = (dx * dx) + (dy * dy);
+
+        const bool hit = distSq <= limit;
+        if (hit)
+        {
+            Collision_SetMaskBits(outMask, i, 1u);
+            ++hits;
+        }
+
+        if (outPenetration)
+        {
+            outPenetration[i] = hit ? Collision_Max(query.radius - std::sqrt(distSq), 0.0f) : 0.0f;
+        }
+    }
+
+    return hits;
+}
+
+size_t Collision_BatchIntersects_CircleCircle(const Collision_Circle& query,
+                                              const Collision_PackedCircles& circles,
+                                              uint64_t* outMask,
+                                              float* outPenetration)
+{
+    const size_t count = circles.Size();
+    if (!Collision_BeginBatch(count, query.radius >= 0.0f, outMask, outPenetration))
+    {
+        return 0;
+    }
+
+    const float* bX = &circles.centerX[0];
+    const float* bY = &circles.centerY[0];
+    const float* bR = &circles.radius[0];
+
+    size_t hits = 0;
+    size_t i = 0;
+#if defined(__AVX__)
+    {
+        const __m256 eps = _mm256_set1_ps(COLLISION_EPSILON);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 ax = _mm256_set1_ps(query.center.x);
+        const __m256 ay = _mm256_set1_ps(query.center.y);
+        const __m256 ar = _mm256_set1_ps(query.radius);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 dx = _mm256_sub_ps(ax, _mm256_loadu_ps(bX + i));
+            const __m256 dy = _mm256_sub_ps(ay, _mm256_loadu_ps(bY + i));
+            const __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            const __m256 sumR = _mm256_add_ps(ar, _mm256_loadu_ps(bR + i));
+
+            const __m256 hit = _mm256_cmp_ps(distSq, _mm256_add_ps(_mm256_mul_ps(sumR, sumR), eps), _CMP_LE_OQ);
+            const unsigned int bits = static_cast<unsigned int>(_mm256_movemask_ps(hit));
+            Collision_SetMaskBits(outMask, i, bits);
+            hits += Collision_CountBits(bits);
+
+            if (outPenetration)
+            {
+                const __m256 pen = _mm256_max_ps(_mm256_sub_ps(sumR, _mm256_sqrt_ps(distSq)), zero);
+                _mm256_storeu_ps(outPenetration + i, _mm256_and_ps(hit, pen));
+            }
+        }
+    }
+#endif
+#if defined(OLYMPE_COLLISION_SSE2)
+    {
+        const __m128 eps = _mm_set1_ps(COLLISION_EPSILON);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 ax = _mm_set1_ps(query.center.x);
+        const __m128 ay = _mm_set1_ps(query.center.y);
+        const __m128 ar = _mm_set1_ps(query.radius);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 dx = _mm_sub_ps(ax, _mm_loadu_ps(bX + i));
+            const __m128 dy = _mm_sub_ps(ay, _mm_loadu_ps(bY + i));
+            const __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            const __m128 sumR = _mm_add_ps(ar, _mm_loadu_ps(bR + i));
+
+            const __m128 hit = _mm_cmple_ps(distSq, _mm_add_ps(_mm_mul_ps(sumR, sumR), eps));
+            const unsigned int bits = static_cast<unsigned int>(_mm_movemask_ps(hit));
+            Collision_SetMaskBits(outMask, i, bits);
+            hits += Collision_CountBits(bits);
+
+            if (outPenetration)
+            {
+                const __m128 pen = _mm_max_ps(_mm_sub_ps(sumR, _mm_sqrt_ps(distSq)), zero);
+                _mm_storeu_ps(outPenetration + i, _mm_and_ps(hit, pen));
+            }
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        const float dx = query.center.x - bX[i];
+        const float dy = query.center.y - bY[i];
+        const float distSq = (dx * dx) + (dy * dy);
+        const float sumR = query.radius + bR[i];
+
+        const bool hit = distSq <= ((sumR * sumR) + COLLISION_EPSILON);
+        if (hit)
+        {
+            Collision_SetMaskBits(outMask, i, 1u);
+            ++hits;
+        }
+
+        if (outPenetration)
+        {
+            outPenetration[i] = hit ? Collision_Max(sumR - std::sqrt(distSq), 0.0f) : 0.0f;
+        }
+    }
+
+    return hits;
+}
+
+size_t Collision_BatchIntersects_AABBCircle(const Collision_AABB& query,
+                                            const Collision_PackedCircles& circles,
+                                            uint64_t* outMask,
+                                            float* outPenetration)
+{
+    const size_t count = circles.Size();
+    if (!Collision_BeginBatch(count, Collision_IsOrderedAABB(query), outMask, outPenetration))
+    {
+        return 0;
+    }
+
+    const float* bX = &circles.centerX[0];
+    const float* bY = &circles.centerY[0];
+    const float* bR = &circles.radius[0];
+
+    size_t hits = 0;
+    size_t i = 0;
+#if defined(__AVX__)
+    {
+        const __m256 eps = _mm256_set1_ps(COLLISION_EPSILON);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 minX = _mm256_set1_ps(query.min.x);
+        const __m256 minY = _mm256_set1_ps(query.min.y);
+        const __m256 maxX = _mm256_set1_ps(query.max.x);
+        const __m256 maxY = _mm256_set1_ps(query.max.y);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 cx = _mm256_loadu_ps(bX + i);
+            const __m256 cy = _mm256_loadu_ps(bY + i);
+            const __m256 r = _mm256_loadu_ps(bR + i);
+            const __m256 dx = _mm256_sub_ps(cx, _mm256_max_ps(minX, _mm256_min_ps(cx, maxX)));
+            const __m256 dy = _mm256_sub_ps(cy, _mm256_max_ps(minY, _mm256_min_ps(cy, maxY)));
+            const __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+            const __m256 hit = _mm256_cmp_ps(distSq, _mm256_add_ps(_mm256_mul_ps(r, r), eps), _CMP_LE_OQ);
+            const unsigned int bits = static_cast<unsigned int>(_mm256_movemask_ps(hit));
+            Collision_SetMaskBits(outMask, i, bits);
+            hits += Collision_CountBits(bits);
+
+            if (outPenetration)
+            {
+                const __m256 pen = _mm256_max_ps(_mm256_sub_ps(r, _mm256_sqrt_ps(distSq)), zero);
+                _mm256_storeu_ps(outPenetration + i, _mm256_and_ps(hit, pen));
+            }
+        }
+    }
+#endif
+#if defined(OLYMPE_COLLISION_SSE2)
+    {
+        const __m128 eps = _mm_set1_ps(COLLISION_EPSILON);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 minX = _mm_set1_ps(query.min.x);
+        const __m128 minY = _mm_set1_ps(query.min.y);
+        const __m128 maxX = _mm_set1_ps(query.max.x);
+        const __m128 maxY = _mm_set1_ps(query.max.y);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 cx = _mm_loadu_ps(bX + i);
+            const __m128 cy = _mm_loadu_ps(bY + i);
+            const __m128 r = _mm_loadu_ps(bR + i);
+            const __m128 dx = _mm_sub_ps(cx, _mm_max_ps(minX, _mm_min_ps(cx, maxX)));
+            const __m128 dy = _mm_sub_ps(cy, _mm_max_ps(minY, _mm_min_ps(cy, maxY)));
+            const __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+            const __m128 hit = _mm_cmple_ps(distSq, _mm_add_ps(_mm_mul_ps(r, r), eps));
+            const unsigned int bits = static_cast<unsigned int>(_mm_movemask_ps(hit));
+            Collision_SetMaskBits(outMask, i, bits);
+            hits += Collision_CountBits(bits);
+
+            if (outPenetration)
+            {
+                const __m128 pen = _mm_max_ps(_mm_sub_ps(r, _mm_sqrt_ps(distSq)), zero);
+                _mm_storeu_ps(outPenetration + i, _mm_and_ps(hit, pen));
+            }
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        const float dx = bX[i] - Collision_Clamp(bX[i], query.min.x, query.max.x);
+        const float dy = bY[i] - Collision_Clamp(bY[i], query.min.y, query.max.y);
+        const float distSq = (dx * dx) + (dy * dy);
+
+        const bool hit = distSq <= ((bR[i] * bR[i]) + COLLISION_EPSILON);
+        if (hit)
+        {
+            Collision_SetMaskBits(outMask, i, 1u);
+            ++hits;
+        }
+
+        if (outPenetration)
+        {
+            outPenetration[i] = hit ? Collision_Max(bR[i] - std::sqrt(distSq), 0.0f) : 0.0f;
+        }
+    }
+
+    return hits;
+}
+
+} // namespace Olympe
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Collision_Primitives.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Olympe {
+
+// Batch kernels: one query shape against N packed shapes, 8 lanes with AVX, 4 with SSE2,
+// then a scalar tail (same compile-time selection as ECS_SoA.h).
+// The lanes perform the same IEEE operations in the same order as the scalar
+// Collision_Intersects_* functions (no fused multiply-add), so the hit bits are identical.
+// Unlike the scalar functions, invalid inputs are rejected without logging.
+//
+// Outputs:
+// - outMask: bit (i % 64) of word (i / 64) is set when shape i intersects the query.
+//   Collision_BatchMaskWordCount(count) words are written.
+// - outPenetration (optional, may be null): count floats, 0 where there is no hit.
+// - returns the number of hits.
+
+// Structure-of-arrays boxes. Invalid boxes are stored as NaN bounds, which fail every
+// comparison: they never intersect, as with the scalar functions.
+struct Collision_PackedAABBs
+{
+    std::vector<float> minX;
+    std::vector<float> minY;
+    std::vector<float> maxX;
+    std::vector<float> maxY;
+
+    void Clear();
+    void Reserve(size_t count);
+    void Push(const Collision_AABB& box);
+    size_t Size() const { return minX.size(); }
+};
+
+// Structure-of-arrays circles. A negative radius is stored as NaN (never intersects).
+struct Collision_PackedCircles
+{
+    std::vector<float> centerX;
+    std::vector<float> centerY;
+    std::vector<float> radius;
+
+    void Clear();
+    void Reserve(size_t count);
+    void Push(const Collision_Circle& circle);
+    size_t Size() const { return centerX.size(); }
+};
+
+inline size_t Collision_BatchMaskWordCount(size_t count)
+{
+    return (count + 63) / 64;
+}
+
+inline bool Collision_BatchMaskTest(const uint64_t* mask, size_t index)
+{
+    return ((mask[index / 64] >> (index % 64)) & 1u) != 0;
+}
+
+// Collision_Intersects_AABBAABB(query, boxes[i]).
+// Penetration: Collision_ComputeContact_AABBAABB(query, boxes[i]).penetration.
+size_t Collision_BatchIntersects_AABBAABB(const Collision_AABB& query,
+                                          const Collision_PackedAABBs& boxes,
+                                          uint64_t* outMask,
+                                          float* outPenetration);
+
+// Collision_Intersects_CircleAABB(query, boxes[i]).
+// Penetration: radius minus the distance from the center to the box (the radius when inside).
+size_t Collision_BatchIntersects_CircleAABB(const Collision_Circle& query,
+                                            const Collision_PackedAABBs& boxes,
+                                            uint64_t* outMask,
+                                            float* outPenetration);
+
+// Collision_Intersects_CircleCircle(query, circles[i]).
+// Penetration: sum of the radii minus the distance between the centers.
+size_t Collision_BatchIntersects_CircleCircle(const Collision_Circle& query,
+                                              const Collision_PackedCircles& circles,
+                                              uint64_t* outMask,
+                                              float* outPenetration);
+
+// Collision_Intersects_CircleAABB(circles[i], query), e.g. a trigger box against agents.
+// Penetration: radius minus the distance from the center to the box (the radius when inside).
+size_t Collision_BatchIntersects_AABBCircle(const Collision_AABB& query,
+                                            const Collision_PackedCircles& circles,
+                                            uint64_t* outMask,
+                                            float* outPenetration);
+
+} // namespace Olympe
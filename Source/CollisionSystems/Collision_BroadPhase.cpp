@@ -3,12 +3,18 @@
 #include <cstddef>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <limits>
 #include <utility>
 #include <vector>
 
 namespace Olympe {
 
 static const float COLLISION_BROAD_PHASE_EPSILON = 0.0001f;
+static const size_t COLLISION_SPATIAL_HASH_MAX_LEVELS = 4;
+static const int COLLISION_SPATIAL_HASH_MAX_CELLS_PER_AXIS = 256;
+static const size_t COLLISION_SPATIAL_HASH_MIN_PROXIES = 64;
+static const float COLLISION_SPATIAL_HASH_NEIGHBOUR_RATIO = 16.0f;
 
 bool Collision_BroadPhaseFilter::Allows(const Collision_SpatialProxy& lhs,
                                         const Collision_SpatialProxy& rhs) const
@@ -78,19 +84,27 @@ static bool Collision_IsValidAABB_NoLog(const Collision_AABB& box)
            (box.min.z <= box.max.z);
 }
 
-static void Collision_CollectValidProxies(const std::vector<Collision_SpatialProxy>& proxies,
+static Collision_SpatialProxySpan Collision_MakeProxySpan(const std::vector<Collision_SpatialProxy>& proxies)
+{
+    Collision_SpatialProxySpan span;
+    span.data = proxies.empty() ? 0 : &proxies[0];
+    span.size = proxies.size();
+    return span;
+}
+
+static void Collision_CollectValidProxies(const Collision_SpatialProxySpan& proxies,
                                           std::vector<Collision_SpatialProxy>& validProxies,
                                           Collision_BroadPhaseMetrics* metrics)
 {
     validProxies.clear();
-    validProxies.reserve(proxies.size());
+    validProxies.reserve(proxies.size);
 
     if (metrics)
     {
-        metrics->inputProxyCount = proxies.size();
+        metrics->inputProxyCount = proxies.size;
     }
 
-    std::vector<Collision_SpatialProxy>::const_iterator it = proxies.begin();
+    const Collision_SpatialProxy* it = proxies.begin();
     for (; it != proxies.end(); ++it)
     {
         if (!Collision_IsValidAABB_NoLog(it->worldAABB))
@@ -147,7 +161,7 @@ static void Collision_FinalizePairs(std::vector<std::pair<EntityID, EntityID> >&
     }
 }
 
-static void Collision_ComputeBroadPhasePairsInternal(const std::vector<Collision_SpatialProxy>& proxies,
+static void Collision_ComputeBroadPhasePairsInternal(const Collision_SpatialProxySpan& proxies,
                                                      std::vector<Collision_CandidatePair>& outPairs,
                                                      Collision_BroadPhaseScratch& scratch,
                                                      Collision_BroadPhaseMetrics* metrics,
@@ -262,7 +276,7 @@ static void Collision_ComputeBroadPhasePairsInternal(const std::vector<Collision
     Collision_FinalizePairs(scratch.normalizedPairs, outPairs, metrics);
 }
 
-static void Collision_ComputeBroadPhasePairsBruteForceInternal(const std::vector<Collision_SpatialProxy>& proxies,
+static void Collision_ComputeBroadPhasePairsBruteForceInternal(const Collision_SpatialProxySpan& proxies,
                                                                std::vector<Collision_CandidatePair>& outPairs,
                                                                Collision_BroadPhaseScratch& scratch,
                                                                Collision_BroadPhaseMetrics* metrics,
@@ -352,6 +366,15 @@ void Collision_ComputeBroadPhasePairs(const std::vector<Collision_SpatialProxy>&
                                       Collision_BroadPhaseScratch& scratch,
                                       Collision_BroadPhaseMetrics* metrics,
                                       const Collision_BroadPhaseFilter& filter)
+{
+    Collision_ComputeBroadPhasePairsInternal(Collision_MakeProxySpan(proxies), outPairs, scratch, metrics, filter);
+}
+
+void Collision_ComputeBroadPhasePairs(const Collision_SpatialProxySpan& proxies,
+                                      std::vector<Collision_CandidatePair>& outPairs,
+                                      Collision_BroadPhaseScratch& scratch,
+                                      Collision_BroadPhaseMetrics* metrics,
+                                      const Collision_BroadPhaseFilter& filter)
 {
     Collision_ComputeBroadPhasePairsInternal(proxies, outPairs, scratch, metrics, filter);
 }
@@ -361,8 +384,937 @@ void Collision_ComputeBroadPhasePairsBruteForce(const std::vector<Collision_Spat
                                                 Collision_BroadPhaseScratch& scratch,
                                                 Collision_BroadPhaseMetrics* metrics,
                                                 const Collision_BroadPhaseFilter& filter)
+{
+    Collision_ComputeBroadPhasePairsBruteForceInternal(Collision_MakeProxySpan(proxies), outPairs, scratch, metrics, filter);
+}
+
+void Collision_ComputeBroadPhasePairsBruteForce(const Collision_SpatialProxySpan& proxies,
+                                                std::vector<Collision_CandidatePair>& outPairs,
+                                                Collision_BroadPhaseScratch& scratch,
+                                                Collision_BroadPhaseMetrics* metrics,
+                                                const Collision_BroadPhaseFilter& filter)
 {
     Collision_ComputeBroadPhasePairsBruteForceInternal(proxies, outPairs, scratch, metrics, filter);
 }
 
+static int32_t Collision_CellCoord(float value, float cellSize)
+{
+    const float cell = std::floor(value / cellSize);
+    if (cell < -1073741824.0f)
+    {
+        return -1073741824;
+    }
+
+    if (cell > 1073741823.0f)
+    {
+        return 1073741823;
+    }
+
+    return static_cast<int32_t>(cell);
+}
+
+// Level in the top 2 bits, then 31 bits per cell coordinate. Cells 2^31 apart share a key:
+// that only adds pair tests, never misses a pair.
+static uint64_t Collision_CellKey(size_t level, int32_t cellX, int32_t cellY)
+{
+    return (static_cast<uint64_t>(level) << 62) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(cellX) & 0x7FFFFFFFu) << 31) |
+           static_cast<uint64_t>(static_cast<uint32_t>(cellY) & 0x7FFFFFFFu);
+}
+
+// Cells covered by a box. The max side carries the epsilon, so two boxes that pass
+// Collision_OverlapWithEpsilon always share at least one cell.
+static void Collision_CellRange(const Collision_AABB& box,
+                                float cellSize,
+                                int32_t& minX,
+                                int32_t& minY,
+                                int32_t& maxX,
+                                int32_t& maxY)
+{
+    minX = Collision_CellCoord(box.min.x, cellSize);
+    minY = Collision_CellCoord(box.min.y, cellSize);
+    maxX = Collision_CellCoord(box.max.x + COLLISION_BROAD_PHASE_EPSILON, cellSize);
+    maxY = Collision_CellCoord(box.max.y + COLLISION_BROAD_PHASE_EPSILON, cellSize);
+}
+
+static size_t Collision_SpatialHashLevel(const Collision_AABB& box, const std::vector<float>& cellSizes, size_t levelCount)
+{
+    const float extent = std::max(box.max.x - box.min.x, box.max.y - box.min.y);
+
+    size_t level = 0;
+    for (; level + 1 < levelCount; ++level)
+    {
+        if (extent <= cellSizes[level])
+        {
+            break;
+        }
+    }
+
+    return level;
+}
+
+static bool Collision_CellEntryLess(const std::pair<uint64_t, uint32_t>& lhs,
+                                    const std::pair<uint64_t, uint32_t>& rhs)
+{
+    if (lhs.first < rhs.first)
+    {
+        return true;
+    }
+
+    if (lhs.first > rhs.first)
+    {
+        return false;
+    }
+
+    return lhs.second < rhs.second;
+}
+
+static bool Collision_CellEntryKeyLess(const std::pair<uint64_t, uint32_t>& entry, uint64_t key)
+{
+    return entry.first < key;
+}
+
+static void Collision_TestCandidatePair(const Collision_SpatialProxy& lhs,
+                                        const Collision_SpatialProxy& rhs,
+                                        std::vector<std::pair<EntityID, EntityID> >& pairs,
+                                        Collision_BroadPhaseMetrics* metrics,
+                                        const Collision_BroadPhaseFilter& filter)
+{
+    if (metrics)
+    {
+        ++metrics->comparisons;
+    }
+
+    if (lhs.entity == rhs.entity)
+    {
+        if (metrics)
+        {
+            ++metrics->selfRejectedPairs;
+        }
+        return;
+    }
+
+    if (!Collision_OverlapWithEpsilon(lhs.worldAABB, rhs.worldAABB, COLLISION_BROAD_PHASE_EPSILON))
+    {
+        if (metrics)
+        {
+            ++metrics->axisRejectedPairs;
+        }
+        return;
+    }
+
+    if (!filter.Allows(lhs, rhs))
+    {
+        if (metrics)
+        {
+            ++metrics->filteredPairs;
+        }
+        return;
+    }
+
+    const EntityID first = (lhs.entity < rhs.entity) ? lhs.entity : rhs.entity;
+    const EntityID second = (lhs.entity < rhs.entity) ? rhs.entity : lhs.entity;
+    pairs.push_back(std::make_pair(first, second));
+}
+
+void Collision_ComputeBroadPhasePairsSpatialHash(const std::vector<Collision_SpatialProxy>& proxies,
+                                                 std::vector<Collision_CandidatePair>& outPairs,
+                                                 Collision_BroadPhaseScratch& scratch,
+                                                 Collision_BroadPhaseMetrics* metrics,
+                                                 const Collision_BroadPhaseFilter& filter,
+                                                 const Collision_SpatialHashConfig& config)
+{
+    Collision_ComputeBroadPhasePairsSpatialHash(Collision_MakeProxySpan(proxies), outPairs, scratch, metrics, filter, config);
+}
+
+void Collision_ComputeBroadPhasePairsSpatialHash(const Collision_SpatialProxySpan& proxies,
+                                                 std::vector<Collision_CandidatePair>& outPairs,
+                                                 Collision_BroadPhaseScratch& scratch,
+                                                 Collision_BroadPhaseMetrics* metrics,
+                                                 const Collision_BroadPhaseFilter& filter,
+                                                 const Collision_SpatialHashConfig& config)
+{
+    if (metrics)
+    {
+        metrics->Reset();
+    }
+
+    Collision_CollectValidProxies(proxies, scratch.sortedProxies, metrics);
+
+    if (scratch.sortedProxies.empty())
+    {
+        outPairs.clear();
+        return;
+    }
+
+    const Collision_SpatialHashConfig defaultConfig;
+    bool validConfig = !config.cellSizes.empty();
+    std::vector<float>::const_iterator itSize = config.cellSizes.begin();
+    for (; itSize != config.cellSizes.end(); ++itSize)
+    {
+        validConfig = validConfig && (*itSize > 0.0f);
+    }
+
+    const std::vector<float>& cellSizes = validConfig ? config.cellSizes : defaultConfig.cellSizes;
+    const size_t levelCount = std::min(cellSizes.size(), COLLISION_SPATIAL_HASH_MAX_LEVELS);
+    const std::vector<Collision_SpatialProxy>& validProxies = scratch.sortedProxies;
+
+    scratch.cellEntries.clear();
+    scratch.cellEntries.reserve(validProxies.size() * 4);
+    scratch.oversizedProxies.clear();
+    scratch.normalizedPairs.clear();
+    scratch.normalizedPairs.reserve(validProxies.size());
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    // Per-cell proxy lists: entries sorted by cell key are contiguous per cell
+    uint32_t index = 0;
+    for (; index < static_cast<uint32_t>(validProxies.size()); ++index)
+    {
+        const Collision_AABB& box = validProxies[index].worldAABB;
+        const size_t level = Collision_SpatialHashLevel(box, cellSizes, levelCount);
+
+        int32_t minX, minY, maxX, maxY;
+        Collision_CellRange(box, cellSizes[level], minX, minY, maxX, maxY);
+
+        // Too many cells even at the last level: tested against every proxy instead
+        if (static_cast<int64_t>(maxX) - minX >= COLLISION_SPATIAL_HASH_MAX_CELLS_PER_AXIS ||
+            static_cast<int64_t>(maxY) - minY >= COLLISION_SPATIAL_HASH_MAX_CELLS_PER_AXIS)
+        {
+            scratch.oversizedProxies.push_back(index);
+            continue;
+        }
+
+        for (int32_t cellY = minY; cellY <= maxY; ++cellY)
+        {
+            for (int32_t cellX = minX; cellX <= maxX; ++cellX)
+            {
+                scratch.cellEntries.push_back(std::make_pair(Collision_CellKey(level, cellX, cellY), index));
+            }
+        }
+    }
+
+    std::sort(scratch.cellEntries.begin(), scratch.cellEntries.end(), Collision_CellEntryLess);
+
+    // Pairs within one cell (same level)
+    size_t runStart = 0;
+    while (runStart < scratch.cellEntries.size())
+    {
+        size_t runEnd = runStart + 1;
+        while (runEnd < scratch.cellEntries.size() &&
+               scratch.cellEntries[runEnd].first == scratch.cellEntries[runStart].first)
+        {
+            ++runEnd;
+        }
+
+        if (metrics && (runEnd - runStart) > metrics->maxActiveCount)
+        {
+            metrics->maxActiveCount = runEnd - runStart;
+        }
+
+        size_t i = runStart;
+        for (; i < runEnd; ++i)
+        {
+            size_t j = i + 1;
+            for (; j < runEnd; ++j)
+            {
+                Collision_TestCandidatePair(validProxies[scratch.cellEntries[i].second],
+                                            validProxies[scratch.cellEntries[j].second],
+                                            scratch.normalizedPairs,
+                                            metrics,
+                                            filter);
+            }
+        }
+
+        runStart = runEnd;
+    }
+
+    // Pairs across levels: each proxy looks up the cells it covers in the coarser levels
+    if (levelCount > 1)
+    {
+        for (index = 0; index < static_cast<uint32_t>(validProxies.size()); ++index)
+        {
+            const Collision_AABB& box = validProxies[index].worldAABB;
+            size_t level = Collision_SpatialHashLevel(box, cellSizes, levelCount) + 1;
+            for (; level < levelCount; ++level)
+            {
+                int32_t minX, minY, maxX, maxY;
+                Collision_CellRange(box, cellSizes[level], minX, minY, maxX, maxY);
+
+                for (int32_t cellY = minY; cellY <= maxY; ++cellY)
+                {
+                    for (int32_t cellX = minX; cellX <= maxX; ++cellX)
+                    {
+                        const uint64_t key = Collision_CellKey(level, cellX, cellY);
+                        std::vector<std::pair<uint64_t, uint32_t> >::const_iterator it =
+                            std::lower_bound(scratch.cellEntries.begin(), scratch.cellEntries.end(), key, Collision_CellEntryKeyLess);
+                        for (; it != scratch.cellEntries.end() && it->first == key; ++it)
+                        {
+                            Collision_TestCandidatePair(validProxies[index],
+                                                        validProxies[it->second],
+                                                        scratch.normalizedPairs,
+                                                        metrics,
+                                                        filter);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Oversized proxies against everything (each oversized pair once)
+    std::vector<uint32_t>::const_iterator itOversized = scratch.oversizedProxies.begin();
+    for (; itOversized != scratch.oversizedProxies.end(); ++itOversized)
+    {
+        for (index = 0; index < static_cast<uint32_t>(validProxies.size()); ++index)
+        {
+            if (index == *itOversized ||
+                (index < *itOversized &&
+                 std::binary_search(scratch.oversizedProxies.begin(), scratch.oversizedProxies.end(), index)))
+            {
+                continue;
+            }
+
+            Collision_TestCandidatePair(validProxies[*itOversized],
+                                        validProxies[index],
+                                        scratch.normalizedPairs,
+                                        metrics,
+                                        filter);
+        }
+    }
+
+    if (metrics)
+    {
+        metrics->elapsedMs = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    Collision_FinalizePairs(scratch.normalizedPairs, outPairs, metrics);
+}
+
+// Mean over proxies of the number of proxies sharing their key (sum of squared run lengths / count)
+static float Collision_MeanKeyOccupancy(std::vector<std::pair<uint64_t, uint32_t> >& entries)
+{
+    if (entries.empty())
+    {
+        return 0.0f;
+    }
+
+    std::sort(entries.begin(), entries.end(), Collision_CellEntryLess);
+
+    double sumSquares = 0.0;
+    size_t runStart = 0;
+    while (runStart < entries.size())
+    {
+        size_t runEnd = runStart + 1;
+        while (runEnd < entries.size() && entries[runEnd].first == entries[runStart].first)
+        {
+            ++runEnd;
+        }
+
+        const double runLength = static_cast<double>(runEnd - runStart);
+        sumSquares += runLength * runLength;
+        runStart = runEnd;
+    }
+
+    return static_cast<float>(sumSquares / static_cast<double>(entries.size()));
+}
+
+void Collision_ComputeProxyDistributionStats(const std::vector<Collision_SpatialProxy>& proxies,
+                                             Collision_ProxyDistributionStats& outStats,
+                                             Collision_BroadPhaseScratch& scratch)
+{
+    outStats = Collision_ProxyDistributionStats();
+
+    Collision_CollectValidProxies(Collision_MakeProxySpan(proxies), scratch.sortedProxies, 0);
+    const std::vector<Collision_SpatialProxy>& validProxies = scratch.sortedProxies;
+    if (validProxies.empty())
+    {
+        return;
+    }
+
+    float minX = validProxies[0].worldAABB.min.x;
+    float minY = validProxies[0].worldAABB.min.y;
+    float maxX = validProxies[0].worldAABB.max.x;
+    float maxY = validProxies[0].worldAABB.max.y;
+    double sumWidth = 0.0;
+    double sumExtent = 0.0;
+
+    std::vector<Collision_SpatialProxy>::const_iterator it = validProxies.begin();
+    for (; it != validProxies.end(); ++it)
+    {
+        const Collision_AABB& box = it->worldAABB;
+        minX = std::min(minX, box.min.x);
+        minY = std::min(minY, box.min.y);
+        maxX = std::max(maxX, box.max.x);
+        maxY = std::max(maxY, box.max.y);
+
+        const float width = box.max.x - box.min.x;
+        const float extent = std::max(width, box.max.y - box.min.y);
+        sumWidth += width;
+        sumExtent += extent;
+        outStats.maxExtent = std::max(outStats.maxExtent, extent);
+    }
+
+    const double count = static_cast<double>(validProxies.size());
+    outStats.proxyCount = validProxies.size();
+    outStats.boundsWidth = maxX - minX;
+    outStats.boundsHeight = maxY - minY;
+    outStats.meanWidth = static_cast<float>(sumWidth / count);
+    outStats.meanExtent = static_cast<float>(sumExtent / count);
+
+    if (!std::isfinite(outStats.boundsWidth) || !std::isfinite(outStats.boundsHeight))
+    {
+        return;
+    }
+
+    // Sweep window: x intervals covering each proxy's min x, counted per mean-width bucket
+    // (large boxes stay in the window over their whole width)
+    float bucketWidth = std::max(outStats.meanWidth, COLLISION_BROAD_PHASE_EPSILON);
+    if (outStats.boundsWidth / bucketWidth > 4096.0f)
+    {
+        bucketWidth = outStats.boundsWidth / 4096.0f;
+    }
+
+    const size_t bucketCount = static_cast<size_t>(Collision_CellCoord(outStats.boundsWidth, bucketWidth)) + 2;
+    std::vector<int> coverage(bucketCount, 0);
+    for (it = validProxies.begin(); it != validProxies.end(); ++it)
+    {
+        ++coverage[Collision_CellCoord(it->worldAABB.min.x - minX, bucketWidth)];
+        --coverage[Collision_CellCoord(it->worldAABB.max.x - minX, bucketWidth) + 1];
+    }
+
+    for (size_t bucket = 1; bucket < bucketCount; ++bucket)
+    {
+        coverage[bucket] += coverage[bucket - 1];
+    }
+
+    double sumCoverage = 0.0;
+    for (it = validProxies.begin(); it != validProxies.end(); ++it)
+    {
+        sumCoverage += coverage[Collision_CellCoord(it->worldAABB.min.x - minX, bucketWidth)];
+    }
+    outStats.sweepNeighbours = static_cast<float>(sumCoverage / count);
+
+    // Grid cell: proxies whose center falls in the same cell
+    const float cellSize = std::max(outStats.meanExtent * 2.0f, COLLISION_BROAD_PHASE_EPSILON);
+    scratch.cellEntries.clear();
+    uint32_t index = 0;
+    for (it = validProxies.begin(); it != validProxies.end(); ++it, ++index)
+    {
+        const Collision_AABB& box = it->worldAABB;
+        const int32_t cellX = Collision_CellCoord((box.min.x + box.max.x) * 0.5f - minX, cellSize);
+        const int32_t cellY = Collision_CellCoord((box.min.y + box.max.y) * 0.5f - minY, cellSize);
+        scratch.cellEntries.push_back(std::make_pair(Collision_CellKey(0, cellX, cellY), index));
+    }
+    outStats.cellNeighbours = Collision_MeanKeyOccupancy(scratch.cellEntries);
+}
+
+Collision_BroadPhaseBackend Collision_SelectBroadPhaseBackend(const Collision_ProxyDistributionStats& stats)
+{
+    // The grid costs more per proxy (several cells, cell lookups): only worth it for
+    // enough proxies and a clearly crowded sweep window
+    if (stats.proxyCount < COLLISION_SPATIAL_HASH_MIN_PROXIES)
+    {
+        return Collision_BroadPhaseBackend::SweepAndPrune;
+    }
+
+    if (stats.sweepNeighbours > stats.cellNeighbours * COLLISION_SPATIAL_HASH_NEIGHBOUR_RATIO)
+    {
+        return Collision_BroadPhaseBackend::SpatialHash;
+    }
+
+    return Collision_BroadPhaseBackend::SweepAndPrune;
+}
+
+Collision_SpatialHashConfig Collision_MakeSpatialHashConfig(const Collision_ProxyDistributionStats& stats)
+{
+    Collision_SpatialHashConfig config;
+    if (stats.proxyCount == 0 || stats.meanExtent <= 0.0f)
+    {
+        return config;
+    }
+
+    config.cellSizes.clear();
+    float cellSize = stats.meanExtent * 2.0f;
+    config.cellSizes.push_back(cellSize);
+    while (config.cellSizes.size() < COLLISION_SPATIAL_HASH_MAX_LEVELS && cellSize < stats.maxExtent)
+    {
+        cellSize *= 4.0f;
+        config.cellSizes.push_back(cellSize);
+    }
+
+    return config;
+}
+
+static bool Collision_CandidatePairLess(const Collision_CandidatePair& lhs,
+                                        const Collision_CandidatePair& rhs)
+{
+    if (lhs.a < rhs.a)
+    {
+        return true;
+    }
+
+    if (lhs.a > rhs.a)
+    {
+        return false;
+    }
+
+    return lhs.b < rhs.b;
+}
+
+static uint64_t Collision_PairKey(EntityID a, EntityID b)
+{
+    const EntityID first = (a < b) ? a : b;
+    const EntityID second = (a < b) ? b : a;
+    return (static_cast<uint64_t>(first) << 32) | static_cast<uint64_t>(second);
+}
+
+static Collision_CandidatePair Collision_PairFromKey(uint64_t key)
+{
+    Collision_CandidatePair pair;
+    pair.a = static_cast<EntityID>(key >> 32);
+    pair.b = static_cast<EntityID>(key & 0xFFFFFFFFu);
+    return pair;
+}
+
+// Max endpoints carry the epsilon: "min before max" in the sorted order is then exactly
+// Collision_OverlapAxisWithEpsilon, ties included (a min sorts before an equal max).
+static float Collision_EndpointValue(const Collision_AABB& box, int axis, bool isMax)
+{
+    if (isMax)
+    {
+        return ((axis == 0) ? box.max.x : box.max.y) + COLLISION_BROAD_PHASE_EPSILON;
+    }
+
+    return (axis == 0) ? box.min.x : box.min.y;
+}
+
+static const uint32_t COLLISION_SAP_INVALID_SLOT = 0xFFFFFFFFu;
+
+// Unordered slot pair, smaller slot in the high half
+static uint64_t Collision_SlotPairKey(uint32_t a, uint32_t b)
+{
+    const uint32_t first = (a < b) ? a : b;
+    const uint32_t second = (a < b) ? b : a;
+    return (static_cast<uint64_t>(first) << 32) | static_cast<uint64_t>(second);
+}
+
+Collision_IncrementalSweepAndPrune::Collision_IncrementalSweepAndPrune()
+    : m_proxyCount(0)
+    , m_pendingRemovals(0)
+    , m_pendingInvalid(0)
+{
+}
+
+uint32_t Collision_IncrementalSweepAndPrune::FindSlot(EntityID id) const
+{
+    const uint32_t entityIndex = GetEntityIndex(id);
+    if (entityIndex >= m_slotByEntityIndex.size())
+    {
+        return COLLISION_SAP_INVALID_SLOT;
+    }
+
+    // The slot's entity rejects an older entity that had the same index
+    const uint32_t slot = m_slotByEntityIndex[entityIndex];
+    if (slot == COLLISION_SAP_INVALID_SLOT || m_slots[slot].proxy.entity != id)
+    {
+        return COLLISION_SAP_INVALID_SLOT;
+    }
+
+    return slot;
+}
+
+void Collision_IncrementalSweepAndPrune::SetProxy(EntityID id, const Collision_AABB& aabb)
+{
+    if (!Collision_IsValidAABB_NoLog(aabb))
+    {
+        ++m_pendingInvalid;
+        RemoveProxy(id);
+        return;
+    }
+
+    const uint32_t existing = FindSlot(id);
+    if (existing != COLLISION_SAP_INVALID_SLOT)
+    {
+        Slot& slot = m_slots[existing];
+        if (slot.removed)
+        {
+            slot.removed = false;
+            --m_pendingRemovals;
+        }
+        slot.proxy.worldAABB = aabb;
+        return;
+    }
+
+    // A removed entity that had the same index keeps its slot until the next Update
+    const uint32_t entityIndex = GetEntityIndex(id);
+    if (entityIndex < m_slotByEntityIndex.size() && m_slotByEntityIndex[entityIndex] != COLLISION_SAP_INVALID_SLOT)
+    {
+        RemoveProxy(m_slots[m_slotByEntityIndex[entityIndex]].proxy.entity);
+        m_slots[m_slotByEntityIndex[entityIndex]].ownsEntityIndex = false;
+    }
+
+    uint32_t index;
+    if (!m_freeSlots.empty())
+    {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.push_back(Slot());
+    }
+
+    Slot& slot = m_slots[index];
+    slot.proxy.entity = id;
+    slot.proxy.worldAABB = aabb;
+    slot.removed = false;
+    slot.ownsEntityIndex = true;
+
+    if (entityIndex >= m_slotByEntityIndex.size())
+    {
+        m_slotByEntityIndex.resize(entityIndex + 1, COLLISION_SAP_INVALID_SLOT);
+    }
+    m_slotByEntityIndex[entityIndex] = index;
+    ++m_proxyCount;
+
+    // Appended past every other endpoint: overlapping nothing until the next sort moves it
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        Endpoint endpoint;
+        endpoint.slot = index;
+        endpoint.isMax = 0;
+        endpoint.value = std::numeric_limits<float>::infinity();
+        m_endpoints[axis].push_back(endpoint);
+        endpoint.isMax = 1;
+        m_endpoints[axis].push_back(endpoint);
+    }
+}
+
+void Collision_IncrementalSweepAndPrune::RemoveProxy(EntityID id)
+{
+    const uint32_t index = FindSlot(id);
+    if (index == COLLISION_SAP_INVALID_SLOT)
+    {
+        return;
+    }
+
+    // Kept until the next sort has moved it away from every proxy it overlaps
+    Slot& slot = m_slots[index];
+    if (!slot.removed)
+    {
+        slot.removed = true;
+        ++m_pendingRemovals;
+    }
+}
+
+void Collision_IncrementalSweepAndPrune::Clear()
+{
+    m_slots.clear();
+    m_freeSlots.clear();
+    m_slotByEntityIndex.clear();
+    m_proxyCount = 0;
+    m_endpoints[0].clear();
+    m_endpoints[1].clear();
+    m_pairs.clear();
+    m_touchedPairs.clear();
+    m_mergedPairs.clear();
+    m_pendingRemovals = 0;
+    m_pendingInvalid = 0;
+}
+
+void Collision_IncrementalSweepAndPrune::Update(std::vector<Collision_CandidatePair>& outAdded,
+                                                std::vector<Collision_CandidatePair>& outRemoved,
+                                                Collision_BroadPhaseMetrics* metrics,
+                                                const Collision_BroadPhaseFilter& filter)
+{
+    if (metrics)
+    {
+        metrics->Reset();
+    }
+
+    outAdded.clear();
+    outRemoved.clear();
+    m_touchedPairs.clear();
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    // Removed proxies move past every other proxy, maxes before mins so that they stop
+    // overlapping each other too: the sort reports the end of all their overlaps
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        std::vector<Endpoint>::iterator it = m_endpoints[axis].begin();
+        for (; it != m_endpoints[axis].end(); ++it)
+        {
+            const Slot& slot = m_slots[it->slot];
+            if (slot.removed)
+            {
+                it->value = it->isMax ? std::numeric_limits<float>::max() : std::numeric_limits<float>::infinity();
+            }
+            else
+            {
+                it->value = Collision_EndpointValue(slot.proxy.worldAABB, axis, it->isMax != 0);
+            }
+        }
+    }
+
+    SortAxis(0, metrics, filter);
+    SortAxis(1, metrics, filter);
+
+    ApplyTouchedPairs(outAdded, outRemoved, filter);
+
+    if (metrics)
+    {
+        // Passed pair tests that did not add a pair (already overlapping, or on both axes)
+        metrics->duplicatePairs = (metrics->pairsBeforeDedup > outAdded.size()) ? metrics->pairsBeforeDedup - outAdded.size() : 0;
+    }
+
+    if (m_pendingRemovals > 0)
+    {
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            std::vector<Endpoint>& endpoints = m_endpoints[axis];
+            size_t kept = 0;
+            for (size_t index = 0; index < endpoints.size(); ++index)
+            {
+                if (!m_slots[endpoints[index].slot].removed)
+                {
+                    endpoints[kept++] = endpoints[index];
+                }
+            }
+            endpoints.resize(kept);
+        }
+
+        for (uint32_t index = 0; index < static_cast<uint32_t>(m_slots.size()); ++index)
+        {
+            Slot& slot = m_slots[index];
+            if (slot.removed && slot.proxy.entity != INVALID_ENTITY_ID)
+            {
+                if (slot.ownsEntityIndex)
+                {
+                    m_slotByEntityIndex[GetEntityIndex(slot.proxy.entity)] = COLLISION_SAP_INVALID_SLOT;
+                }
+                slot.proxy.entity = INVALID_ENTITY_ID;
+                m_freeSlots.push_back(index);
+                --m_proxyCount;
+            }
+        }
+
+        m_pendingRemovals = 0;
+    }
+
+    if (metrics)
+    {
+        metrics->elapsedMs = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - startTime).count();
+        metrics->validProxyCount = m_proxyCount;
+        metrics->invalidProxyCount = m_pendingInvalid;
+        metrics->inputProxyCount = metrics->validProxyCount + metrics->invalidProxyCount;
+        metrics->pairsAfterDedup = m_pairs.size();
+    }
+
+    m_pendingInvalid = 0;
+}
+
+void Collision_IncrementalSweepAndPrune::SortAxis(int axis,
+                                                  Collision_BroadPhaseMetrics* metrics,
+                                                  const Collision_BroadPhaseFilter& filter)
+{
+    std::vector<Endpoint>& endpoints = m_endpoints[axis];
+
+    size_t index = 1;
+    for (; index < endpoints.size(); ++index)
+    {
+        const Endpoint moving = endpoints[index];
+        size_t position = index;
+
+        while (position > 0)
+        {
+            const Endpoint& previous = endpoints[position - 1];
+
+            if (metrics)
+            {
+                ++metrics->comparisons;
+            }
+
+            const bool movingFirst = (moving.value < previous.value) ||
+                                     (moving.value == previous.value && moving.isMax < previous.isMax);
+            if (!movingFirst)
+            {
+                break;
+            }
+
+            if (moving.isMax != previous.isMax)
+            {
+                if (moving.isMax == 0)
+                {
+                    BeginOverlap(moving.slot, previous.slot, metrics, filter);
+                }
+                else
+                {
+                    EndOverlap(moving.slot, previous.slot);
+                }
+            }
+
+            endpoints[position] = previous;
+            --position;
+        }
+
+        endpoints[position] = moving;
+
+        if (metrics && (index - position) > metrics->maxActiveCount)
+        {
+            metrics->maxActiveCount = index - position;
+        }
+    }
+}
+
+void Collision_IncrementalSweepAndPrune::BeginOverlap(uint32_t slotA,
+                                                      uint32_t slotB,
+                                                      Collision_BroadPhaseMetrics* metrics,
+                                                      const Collision_BroadPhaseFilter& filter)
+{
+    const Slot& lhs = m_slots[slotA];
+    const Slot& rhs = m_slots[slotB];
+
+    if (slotA == slotB || lhs.removed || rhs.removed)
+    {
+        return;
+    }
+
+    // Overlapping on this axis now; the other axis decides
+    if (!Collision_OverlapWithEpsilon(lhs.proxy.worldAABB, rhs.proxy.worldAABB, COLLISION_BROAD_PHASE_EPSILON))
+    {
+        if (metrics)
+        {
+            ++metrics->axisRejectedPairs;
+        }
+        return;
+    }
+
+    if (!filter.Allows(lhs.proxy, rhs.proxy))
+    {
+        if (metrics)
+        {
+            ++metrics->filteredPairs;
+        }
+        return;
+    }
+
+    if (metrics)
+    {
+        ++metrics->pairsBeforeDedup;
+    }
+
+    m_touchedPairs.push_back(Collision_SlotPairKey(slotA, slotB));
+}
+
+void Collision_IncrementalSweepAndPrune::EndOverlap(uint32_t slotA, uint32_t slotB)
+{
+    // Separated on this axis: no test needed, the pair is settled after the sorts
+    if (slotA != slotB)
+    {
+        m_touchedPairs.push_back(Collision_SlotPairKey(slotA, slotB));
+    }
+}
+
+void Collision_IncrementalSweepAndPrune::ApplyTouchedPairs(std::vector<Collision_CandidatePair>& outAdded,
+                                                           std::vector<Collision_CandidatePair>& outRemoved,
+                                                           const Collision_BroadPhaseFilter& filter)
+{
+    if (m_touchedPairs.empty())
+    {
+        return;
+    }
+
+    // A pair may cross several times during one update: only its final state counts,
+    // which is the pair test on the final boxes (the sorted order matches it exactly)
+    std::sort(m_touchedPairs.begin(), m_touchedPairs.end());
+    m_touchedPairs.erase(std::unique(m_touchedPairs.begin(), m_touchedPairs.end()), m_touchedPairs.end());
+
+    std::vector<uint64_t>::const_iterator it = m_touchedPairs.begin();
+    for (; it != m_touchedPairs.end(); ++it)
+    {
+        const Slot& lhs = m_slots[static_cast<uint32_t>(*it >> 32)];
+        const Slot& rhs = m_slots[static_cast<uint32_t>(*it & 0xFFFFFFFFu)];
+
+        const uint64_t key = Collision_PairKey(lhs.proxy.entity, rhs.proxy.entity);
+        const bool wasOverlapping = std::binary_search(m_pairs.begin(), m_pairs.end(), key);
+        const bool isOverlapping = !lhs.removed && !rhs.removed &&
+                                   Collision_OverlapWithEpsilon(lhs.proxy.worldAABB, rhs.proxy.worldAABB, COLLISION_BROAD_PHASE_EPSILON) &&
+                                   filter.Allows(lhs.proxy, rhs.proxy);
+
+        if (isOverlapping && !wasOverlapping)
+        {
+            outAdded.push_back(Collision_PairFromKey(key));
+        }
+        else if (!isOverlapping && wasOverlapping)
+        {
+            outRemoved.push_back(Collision_PairFromKey(key));
+        }
+    }
+
+    if (outAdded.empty() && outRemoved.empty())
+    {
+        return;
+    }
+
+    std::sort(outAdded.begin(), outAdded.end(), Collision_CandidatePairLess);
+    std::sort(outRemoved.begin(), outRemoved.end(), Collision_CandidatePairLess);
+
+    // One merge pass keeps the pair list sorted: O(pairs + changes), no full sort
+    m_mergedPairs.clear();
+    m_mergedPairs.reserve(m_pairs.size() + outAdded.size());
+    std::vector<Collision_CandidatePair>::const_iterator added = outAdded.begin();
+    std::vector<Collision_CandidatePair>::const_iterator removed = outRemoved.begin();
+    std::vector<uint64_t>::const_iterator current = m_pairs.begin();
+    for (; current != m_pairs.end(); ++current)
+    {
+        while (added != outAdded.end() && Collision_PairKey(added->a, added->b) < *current)
+        {
+            m_mergedPairs.push_back(Collision_PairKey(added->a, added->b));
+            ++added;
+        }
+
+        if (removed != outRemoved.end() && Collision_PairKey(removed->a, removed->b) == *current)
+        {
+            ++removed;
+            continue;
+        }
+
+        m_mergedPairs.push_back(*current);
+    }
+    for (; added != outAdded.end(); ++added)
+    {
+        m_mergedPairs.push_back(Collision_PairKey(added->a, added->b));
+    }
+
+    m_pairs.swap(m_mergedPairs);
+}
+
+void Collision_IncrementalSweepAndPrune::GetPairs(std::vector<Collision_CandidatePair>& outPairs) const
+{
+    // Already sorted by (a, b)
+    outPairs.clear();
+    outPairs.reserve(m_pairs.size());
+
+    std::vector<uint64_t>::const_iterator it = m_pairs.begin();
+    for (; it != m_pairs.end(); ++it)
+    {
+        outPairs.push_back(Collision_PairFromKey(*it));
+    }
+}
+
+size_t Collision_IncrementalSweepAndPrune::GetProxyCount() const
+{
+    return m_proxyCount - m_pendingRemovals;
+}
+
+size_t Collision_IncrementalSweepAndPrune::GetPairCount() const
+{
+    return m_pairs.size();
+}
+
 } // namespace Olympe
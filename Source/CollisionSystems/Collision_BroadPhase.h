@@ -4,6 +4,7 @@
 #include "../ECS_Entity.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -63,12 +64,16 @@ struct Collision_BroadPhaseScratch
     std::vector<Collision_SpatialProxy> sortedProxies;
     std::vector<Collision_SpatialProxy> activeProxies;
     std::vector<std::pair<EntityID, EntityID> > normalizedPairs;
+    std::vector<std::pair<uint64_t, uint32_t> > cellEntries;
+    std::vector<uint32_t> oversizedProxies;
 
     void Clear()
     {
         sortedProxies.clear();
         activeProxies.clear();
         normalizedPairs.clear();
+        cellEntries.clear();
+        oversizedProxies.clear();
     }
 };
 
@@ -112,4 +117,168 @@ void Collision_ComputeBroadPhasePairsBruteForce(const std::vector<Collision_Spat
                                                 Collision_BroadPhaseMetrics* metrics,
                                                 const Collision_BroadPhaseFilter& filter);
 
+// Same entry points reading the registry's dense array in place (Collision_SpatialProxyRegistry::GetProxies)
+void Collision_ComputeBroadPhasePairs(const Collision_SpatialProxySpan& proxies,
+                                      std::vector<Collision_CandidatePair>& outPairs,
+                                      Collision_BroadPhaseScratch& scratch,
+                                      Collision_BroadPhaseMetrics* metrics,
+                                      const Collision_BroadPhaseFilter& filter);
+
+void Collision_ComputeBroadPhasePairsBruteForce(const Collision_SpatialProxySpan& proxies,
+                                                std::vector<Collision_CandidatePair>& outPairs,
+                                                Collision_BroadPhaseScratch& scratch,
+                                                Collision_BroadPhaseMetrics* metrics,
+                                                const Collision_BroadPhaseFilter& filter);
+
+// Levels of the spatial hash grid, cell sizes ascending and > 0 (at most 4 levels are used,
+// an empty or invalid list falls back to the default).
+// A proxy lives in the first level whose cell size is at least its largest extent, so it
+// covers at most 2x2 cells there; proxies larger than the last level cover more cells.
+struct Collision_SpatialHashConfig
+{
+    std::vector<float> cellSizes;
+
+    Collision_SpatialHashConfig()
+        : cellSizes(1, 64.0f)
+    {
+    }
+};
+
+// Same contract as Collision_ComputeBroadPhasePairs, with per-cell proxy lists instead of an
+// x sweep: proxies that share an x range but not a y range are never compared.
+// Metrics: maxActiveCount = longest cell list, duplicatePairs = pairs met in several cells.
+void Collision_ComputeBroadPhasePairsSpatialHash(const std::vector<Collision_SpatialProxy>& proxies,
+                                                 std::vector<Collision_CandidatePair>& outPairs,
+                                                 Collision_BroadPhaseScratch& scratch,
+                                                 Collision_BroadPhaseMetrics* metrics,
+                                                 const Collision_BroadPhaseFilter& filter,
+                                                 const Collision_SpatialHashConfig& config);
+
+void Collision_ComputeBroadPhasePairsSpatialHash(const Collision_SpatialProxySpan& proxies,
+                                                 std::vector<Collision_CandidatePair>& outPairs,
+                                                 Collision_BroadPhaseScratch& scratch,
+                                                 Collision_BroadPhaseMetrics* metrics,
+                                                 const Collision_BroadPhaseFilter& filter,
+                                                 const Collision_SpatialHashConfig& config);
+
+enum class Collision_BroadPhaseBackend
+{
+    SweepAndPrune,
+    SpatialHash
+};
+
+// Proxy distribution, used to pick a broad-phase backend and size the grid.
+// Neighbour estimates are mean proxy counts per proxy: x intervals covering its min x
+// (sweep window), proxies centered in its cell of 2 * mean extent (grid). They stay 0
+// when a box is infinite.
+struct Collision_ProxyDistributionStats
+{
+    size_t proxyCount;
+    float boundsWidth;
+    float boundsHeight;
+    float meanWidth;
+    float meanExtent;
+    float maxExtent;
+    float sweepNeighbours;
+    float cellNeighbours;
+
+    Collision_ProxyDistributionStats()
+        : proxyCount(0)
+        , boundsWidth(0.0f)
+        , boundsHeight(0.0f)
+        , meanWidth(0.0f)
+        , meanExtent(0.0f)
+        , maxExtent(0.0f)
+        , sweepNeighbours(0.0f)
+        , cellNeighbours(0.0f)
+    {
+    }
+};
+
+void Collision_ComputeProxyDistributionStats(const std::vector<Collision_SpatialProxy>& proxies,
+                                             Collision_ProxyDistributionStats& outStats,
+                                             Collision_BroadPhaseScratch& scratch);
+
+// Sweep-and-prune unless the sweep window is expected to hold over 16 times more proxies
+// than a grid cell (crowds sharing an x range, large boxes among small ones). The ratio comes
+// from CollisionBenchmark: below it, the grid's extra cells and lookups cost more than they save.
+Collision_BroadPhaseBackend Collision_SelectBroadPhaseBackend(const Collision_ProxyDistributionStats& stats);
+
+// Levels sized from the distribution: 2 * mean extent, then x4 up to the largest proxy.
+Collision_SpatialHashConfig Collision_MakeSpatialHashConfig(const Collision_ProxyDistributionStats& stats);
+
+// Persistent sweep-and-prune for proxies that move a little from one update to the next.
+// Min/max endpoints stay sorted on x and y between updates: each update refreshes their
+// values and repairs both axes with insertion sort, which is close to linear when the order
+// barely changed. A min endpoint passing a max endpoint is exactly a pair starting (or
+// stopping) to overlap on that axis, so only those pairs are tested.
+// Contract:
+// - same epsilon-expanded overlap test, filter and pair normalization as
+//   Collision_ComputeBroadPhasePairs: GetPairs() returns what it would return for the same proxies.
+// - SetProxy/RemoveProxy are applied by the next Update; SetProxy with an invalid AABB removes the proxy.
+// - Update reports the pairs that started/stopped overlapping since the previous Update,
+//   both cleared on entry and sorted by a ascending, then b ascending. The pair list is kept
+//   sorted by merging them in (no hashing, no full sort): GetPairs() is a plain copy.
+// - the filter must give the same answers from one update to the next (Clear() to change it).
+// Metrics: comparisons = endpoint comparisons of the insertion sorts, maxActiveCount = longest
+// distance an endpoint moved, pairsBeforeDedup = pair tests that passed, pairsAfterDedup =
+// overlapping pairs after the update, duplicatePairs = passed tests that added no pair.
+class Collision_IncrementalSweepAndPrune
+{
+public:
+    Collision_IncrementalSweepAndPrune();
+
+    void SetProxy(EntityID id, const Collision_AABB& aabb);
+    void RemoveProxy(EntityID id);
+    void Clear();
+
+    void Update(std::vector<Collision_CandidatePair>& outAdded,
+                std::vector<Collision_CandidatePair>& outRemoved,
+                Collision_BroadPhaseMetrics* metrics,
+                const Collision_BroadPhaseFilter& filter);
+
+    void GetPairs(std::vector<Collision_CandidatePair>& outPairs) const;
+    size_t GetProxyCount() const;
+    size_t GetPairCount() const;
+
+private:
+    struct Slot
+    {
+        Collision_SpatialProxy proxy;
+        bool removed;
+        bool ownsEntityIndex;   // False once a newer entity with the same index took over
+    };
+
+    struct Endpoint
+    {
+        float value;
+        uint32_t slot;
+        uint32_t isMax;
+    };
+
+    uint32_t FindSlot(EntityID id) const;
+    void SortAxis(int axis,
+                  Collision_BroadPhaseMetrics* metrics,
+                  const Collision_BroadPhaseFilter& filter);
+    void BeginOverlap(uint32_t slotA,
+                      uint32_t slotB,
+                      Collision_BroadPhaseMetrics* metrics,
+                      const Collision_BroadPhaseFilter& filter);
+    void EndOverlap(uint32_t slotA, uint32_t slotB);
+    void ApplyTouchedPairs(std::vector<Collision_CandidatePair>& outAdded,
+                           std::vector<Collision_CandidatePair>& outRemoved,
+                           const Collision_BroadPhaseFilter& filter);
+
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<uint32_t> m_slotByEntityIndex;      // GetEntityIndex -> slot, like the proxy registry
+    size_t m_proxyCount;                            // Slots in use, pending removals included
+    std::vector<Endpoint> m_endpoints[2];
+    std::vector<uint64_t> m_pairs;                  // Overlapping pairs, keys sorted by (a, b)
+    std::vector<uint64_t> m_touchedPairs;           // Slot pairs that crossed during the update
+    std::vector<uint64_t> m_mergedPairs;            // Merge scratch, swapped with m_pairs
+    size_t m_pendingRemovals;
+    size_t m_pendingInvalid;
+};
+
 } // namespace Olympe
@@ -0,0 +1,206 @@
+#include "Collision_ContactTracker.h"
+
+namespace Olympe {
+
+template <typename Lhs, typename Rhs>
+static bool Collision_PairBefore(const Lhs& lhs, const Rhs& rhs)
+{
+    return lhs.a < rhs.a || (lhs.a == rhs.a && lhs.b < rhs.b);
+}
+
+// Collision_IsValidAABB without the log: the owner pushes the same invalid box every run
+static bool Collision_IsOrderedAABB(const Collision_AABB& box)
+{
+    return box.min.x <= box.max.x && box.min.y <= box.max.y && box.min.z <= box.max.z;
+}
+
+static bool Collision_SameAABB(const Collision_AABB& lhs, const Collision_AABB& rhs)
+{
+    return lhs.min.x == rhs.min.x && lhs.min.y == rhs.min.y && lhs.min.z == rhs.min.z &&
+           lhs.max.x == rhs.max.x && lhs.max.y == rhs.max.y && lhs.max.z == rhs.max.z;
+}
+
+Collision_ContactTracker::Collision_ContactTracker()
+    : m_lastUpdateCount(0)
+    , m_changed(false)
+{
+}
+
+bool Collision_ContactTracker::SetBox(EntityID entity, const Collision_AABB& box)
+{
+    const Collision_ProxyHandle handle = m_registry.FindProxy(entity);
+    if (!Collision_IsOrderedAABB(box))
+    {
+        RemoveBox(entity);
+        return handle != COLLISION_INVALID_PROXY_HANDLE;
+    }
+
+    const Collision_SpatialProxy* proxy = m_registry.GetProxy(handle);
+    if (proxy && Collision_SameAABB(proxy->worldAABB, box))
+    {
+        return false;
+    }
+
+    Collision_SpatialProxy update;
+    update.entity = entity;
+    update.worldAABB = box;
+    m_proxyBatch.push_back(update);
+    return true;
+}
+
+void Collision_ContactTracker::RemoveBox(EntityID entity)
+{
+    // Drop a box queued earlier in the same run
+    size_t kept = 0;
+    for (size_t i = 0; i < m_proxyBatch.size(); ++i)
+    {
+        if (m_proxyBatch[i].entity != entity)
+        {
+            m_proxyBatch[kept++] = m_proxyBatch[i];
+        }
+    }
+    m_proxyBatch.resize(kept);
+
+    if (m_registry.FindProxy(entity) == COLLISION_INVALID_PROXY_HANDLE)
+    {
+        return;
+    }
+
+    // Its contacts end on the next Update
+    m_registry.RemoveProxy(entity);
+    m_broadPhase.RemoveProxy(entity);
+    m_changed = true;
+}
+
+void Collision_ContactTracker::Clear()
+{
+    m_registry.Clear();
+    m_proxyBatch.clear();
+    m_lastUpdateCount = 0;
+    m_changed = false;
+    m_broadPhase.Clear();
+    m_addedPairs.clear();
+    m_removedPairs.clear();
+    m_metrics = Collision_BroadPhaseMetrics();
+    m_contacts.clear();
+    m_previousContacts.clear();
+    m_movedByEntityIndex.clear();
+}
+
+bool Collision_ContactTracker::Update(std::vector<Collision_Contact>& outBegan, std::vector<Collision_Contact>& outEnded)
+{
+    outBegan.clear();
+    outEnded.clear();
+
+    // One batch into the registry (narrow-phase boxes) and the broad phase
+    m_lastUpdateCount = m_proxyBatch.size();
+    if (!m_proxyBatch.empty())
+    {
+        m_registry.RegisterOrUpdateProxies(&m_proxyBatch[0], m_proxyBatch.size());
+        std::vector<Collision_SpatialProxy>::const_iterator it = m_proxyBatch.begin();
+        for (; it != m_proxyBatch.end(); ++it)
+        {
+            m_broadPhase.SetProxy(it->entity, it->worldAABB);
+            SetMoved(it->entity, true);
+        }
+        m_changed = true;
+    }
+
+    // Same boxes as the last update: same contacts
+    if (!m_changed)
+    {
+        return false;
+    }
+    m_changed = false;
+
+    // Broad phase: endpoint lists repaired around the proxies that changed, pairs that
+    // started/stopped overlapping reported as deltas
+    m_broadPhase.Update(m_addedPairs, m_removedPairs, &m_metrics, Collision_BroadPhaseFilter());
+
+    // The broad phase runs the narrow phase's epsilon overlap test, so its pairs are exactly
+    // the contacts: removed pairs end, added pairs begin, and the contact data is only
+    // recomputed for pairs with a moved box. All lists are sorted by (a, b): one merge pass.
+    m_previousContacts.swap(m_contacts);
+    m_contacts.clear();
+
+    size_t previous = 0;
+    size_t added = 0;
+    size_t removed = 0;
+    while (previous < m_previousContacts.size() || added < m_addedPairs.size())
+    {
+        const bool takeAdded = previous == m_previousContacts.size() ||
+                               (added < m_addedPairs.size() && Collision_PairBefore(m_addedPairs[added], m_previousContacts[previous]));
+        if (takeAdded)
+        {
+            Collision_Contact contact;
+            if (ComputeContact(m_addedPairs[added], contact))
+            {
+                m_contacts.push_back(contact);
+                outBegan.push_back(contact);
+            }
+            ++added;
+            continue;
+        }
+
+        Collision_Contact& contact = m_previousContacts[previous++];
+        while (removed < m_removedPairs.size() && Collision_PairBefore(m_removedPairs[removed], contact))
+        {
+            ++removed;
+        }
+        if (removed < m_removedPairs.size() && m_removedPairs[removed].a == contact.a && m_removedPairs[removed].b == contact.b)
+        {
+            outEnded.push_back(contact);
+            continue;
+        }
+
+        if (IsMoved(contact.a) || IsMoved(contact.b))
+        {
+            Collision_CandidatePair pair;
+            pair.a = contact.a;
+            pair.b = contact.b;
+            ComputeContact(pair, contact);
+        }
+        m_contacts.push_back(contact);
+    }
+
+    std::vector<Collision_SpatialProxy>::const_iterator it = m_proxyBatch.begin();
+    for (; it != m_proxyBatch.end(); ++it)
+    {
+        SetMoved(it->entity, false);
+    }
+    m_proxyBatch.clear();
+
+    return true;
+}
+
+bool Collision_ContactTracker::ComputeContact(const Collision_CandidatePair& pair, Collision_Contact& outContact) const
+{
+    const Collision_SpatialProxy* proxyA = m_registry.GetProxy(m_registry.FindProxy(pair.a));
+    const Collision_SpatialProxy* proxyB = m_registry.GetProxy(m_registry.FindProxy(pair.b));
+    if (!proxyA || !proxyB)
+    {
+        return false;
+    }
+
+    outContact.a = pair.a;
+    outContact.b = pair.b;
+    return Collision_ComputeContact_AABBAABB(proxyA->worldAABB, proxyB->worldAABB, outContact.result);
+}
+
+void Collision_ContactTracker::SetMoved(EntityID entity, bool moved)
+{
+    const uint32_t entityIndex = GetEntityIndex(entity);
+    if (entityIndex >= m_movedByEntityIndex.size())
+    {
+        m_movedByEntityIndex.resize(entityIndex + 1, 0);
+    }
+    m_movedByEntityIndex[entityIndex] = moved ? 1 : 0;
+}
+
+bool Collision_ContactTracker::IsMoved(EntityID entity) const
+{
+    const uint32_t entityIndex = GetEntityIndex(entity);
+    return entityIndex < m_movedByEntityIndex.size() && m_movedByEntityIndex[entityIndex] != 0;
+}
+
+} // namespace Olympe
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Collision_BroadPhase.h"
+#include "Collision_Intersections.h"
+#include "Collision_SpatialProxyRegistry.h"
+#include "../ECS_Entity.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Olympe {
+
+struct Collision_Contact
+{
+    EntityID a;        // a < b
+    EntityID b;
+    Collision_ContactResult result;
+
+    Collision_Contact()
+        : a(INVALID_ENTITY_ID)
+        , b(INVALID_ENTITY_ID)
+    {
+    }
+};
+
+// Contacts between persistent entity boxes, independent of the ECS (used by CollisionSystem).
+// The owner pushes the current box of every entity each run: SetBox compares it with the
+// stored proxy and only queues the boxes that changed, so the broad phase (incremental
+// sweep-and-prune) is only repaired around boxes that really moved, whoever moved them.
+// Update consumes the broad phase's added/removed pair deltas: contacts begin and end with
+// them, and the contact data is only recomputed for pairs that involve a moved box.
+class Collision_ContactTracker
+{
+public:
+    Collision_ContactTracker();
+
+    // Queues the box for the next Update; false when it equals the stored one.
+    // An invalid box (min > max) removes the entity's proxy, without a log.
+    bool SetBox(EntityID entity, const Collision_AABB& box);
+    void RemoveBox(EntityID entity);
+    void Clear();
+
+    // Applies the queued boxes and removals. Returns false, with both lists empty, when
+    // nothing changed since the previous Update. Both lists are sorted by (a, b).
+    bool Update(std::vector<Collision_Contact>& outBegan, std::vector<Collision_Contact>& outEnded);
+
+    // Contacts after the last Update, sorted by (a, b)
+    const std::vector<Collision_Contact>& GetContacts() const { return m_contacts; }
+
+    // Broad phase statistics of the last Update that changed a box
+    const Collision_BroadPhaseMetrics& GetBroadPhaseMetrics() const { return m_metrics; }
+    // Boxes applied by the last Update
+    size_t GetProxyUpdateCount() const { return m_lastUpdateCount; }
+    size_t GetProxyCount() const { return m_registry.GetProxyCount(); }
+
+private:
+    bool ComputeContact(const Collision_CandidatePair& pair, Collision_Contact& outContact) const;
+    void SetMoved(EntityID entity, bool moved);
+    bool IsMoved(EntityID entity) const;
+
+    Collision_SpatialProxyRegistry m_registry;
+    std::vector<Collision_SpatialProxy> m_proxyBatch;   // Queued by SetBox
+    size_t m_lastUpdateCount;
+    bool m_changed;
+
+    // Broad phase input/output, kept between updates (no allocation once warm)
+    Collision_IncrementalSweepAndPrune m_broadPhase;
+    std::vector<Collision_CandidatePair> m_addedPairs;
+    std::vector<Collision_CandidatePair> m_removedPairs;
+    Collision_BroadPhaseMetrics m_metrics;
+
+    std::vector<Collision_Contact> m_contacts;
+    std::vector<Collision_Contact> m_previousContacts;
+    std::vector<uint8_t> m_movedByEntityIndex;          // Boxes applied by the running Update
+};
+
+} // namespace Olympe
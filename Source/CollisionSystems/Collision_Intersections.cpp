@@ -124,4 +124,45 @@ bool Collision_Intersects_AABBAABB(const Collision_AABB& a,
     return overlapX && overlapY;
 }
 
+bool Collision_ComputeContact_AABBAABB(const Collision_AABB& a,
+                                       const Collision_AABB& b,
+                                       Collision_ContactResult& out)
+{
+    out = Collision_ContactResult();
+
+    if (!Collision_Intersects_AABBAABB(a, b))
+    {
+        return false;
+    }
+
+    const float overlapMinX = Collision_Max(a.min.x, b.min.x);
+    const float overlapMaxX = Collision_Min(a.max.x, b.max.x);
+    const float overlapMinY = Collision_Max(a.min.y, b.min.y);
+    const float overlapMaxY = Collision_Min(a.max.y, b.max.y);
+
+    // Overlap extents (slightly negative within the epsilon when the boxes only touch)
+    const float penetrationX = Collision_Max(overlapMaxX - overlapMinX, 0.0f);
+    const float penetrationY = Collision_Max(overlapMaxY - overlapMinY, 0.0f);
+
+    const float centerDeltaX = (b.min.x + b.max.x) - (a.min.x + a.max.x);
+    const float centerDeltaY = (b.min.y + b.max.y) - (a.min.y + a.max.y);
+
+    out.intersects = true;
+    out.point.x = 0.5f * (overlapMinX + overlapMaxX);
+    out.point.y = 0.5f * (overlapMinY + overlapMaxY);
+
+    if (penetrationX <= penetrationY)
+    {
+        out.normal.x = (centerDeltaX < 0.0f) ? -1.0f : 1.0f;
+        out.penetration = penetrationX;
+    }
+    else
+    {
+        out.normal.y = (centerDeltaY < 0.0f) ? -1.0f : 1.0f;
+        out.penetration = penetrationY;
+    }
+
+    return true;
+}
+
 } // namespace Olympe
@@ -19,4 +19,11 @@ bool Collision_Intersects_CircleAABB(const Collision_Circle& circle,
 bool Collision_Intersects_AABBAABB(const Collision_AABB& a,
                                    const Collision_AABB& b);
 
+// Contact of two overlapping boxes: the normal points from a to b along the axis of
+// least penetration (x on ties), the point is the center of the overlap area.
+// Returns false (out.intersects == false) when the boxes do not intersect.
+bool Collision_ComputeContact_AABBAABB(const Collision_AABB& a,
+                                       const Collision_AABB& b,
+                                       Collision_ContactResult& out);
+
 } // namespace Olympe
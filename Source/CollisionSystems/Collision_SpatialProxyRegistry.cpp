@@ -4,41 +4,234 @@
 
 namespace Olympe {
 
-void Collision_SpatialProxyRegistry::RegisterOrUpdateProxy(EntityID id, const Collision_AABB& aabb)
+static const uint32_t COLLISION_PROXY_SLOT_BITS = 20;
+static const uint32_t COLLISION_PROXY_SLOT_MASK = (1u << COLLISION_PROXY_SLOT_BITS) - 1;
+static const uint32_t COLLISION_PROXY_GENERATION_MASK = (1u << (32 - COLLISION_PROXY_SLOT_BITS)) - 1;
+static const uint32_t COLLISION_PROXY_INVALID_DENSE_INDEX = 0xFFFFFFFFu;
+
+static Collision_ProxyHandle Collision_MakeProxyHandle(uint32_t slot, uint32_t generation)
+{
+    return ((generation & COLLISION_PROXY_GENERATION_MASK) << COLLISION_PROXY_SLOT_BITS) | (slot & COLLISION_PROXY_SLOT_MASK);
+}
+
+Collision_SpatialProxyRegistry::Collision_SpatialProxyRegistry()
+    : m_retiredSlotCount(0)
+{
+}
+
+Collision_ProxyHandle Collision_SpatialProxyRegistry::RegisterOrUpdateProxy(EntityID id, const Collision_AABB& aabb)
 {
     if (!Collision_IsValidAABB(aabb))
     {
         SYSTEM_LOG << "[Collision] Collision_SpatialProxyRegistry ignored invalid AABB for entity="
                    << id << std::endl;
-        return;
+        return COLLISION_INVALID_PROXY_HANDLE;
+    }
+
+    const Collision_ProxyHandle existing = FindProxy(id);
+    if (existing != COLLISION_INVALID_PROXY_HANDLE)
+    {
+        m_dense[m_slots[existing & COLLISION_PROXY_SLOT_MASK].denseIndex].worldAABB = aabb;
+        return existing;
+    }
+
+    // An older entity with the same index is replaced: once the index maps to the new
+    // entity, its proxy could no longer be found nor removed
+    const uint32_t entityIndex = GetEntityIndex(id);
+    if (entityIndex < m_handleByEntityIndex.size())
+    {
+        const uint32_t previousIndex = FindDenseIndex(m_handleByEntityIndex[entityIndex]);
+        if (previousIndex != COLLISION_PROXY_INVALID_DENSE_INDEX)
+        {
+            RemoveProxy(m_dense[previousIndex].entity);
+        }
+    }
+
+    uint32_t slot;
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        // The last slot index is never issued: slot 0xFFFFF at generation 0xFFF would encode
+        // COLLISION_INVALID_PROXY_HANDLE, and a larger index would alias slot 0
+        if (m_slots.size() >= COLLISION_PROXY_SLOT_MASK)
+        {
+            SYSTEM_LOG << "[Collision] Collision_SpatialProxyRegistry is full, proxy ignored for entity="
+                       << id << std::endl;
+            return COLLISION_INVALID_PROXY_HANDLE;
+        }
+
+        slot = static_cast<uint32_t>(m_slots.size());
+        Slot newSlot;
+        newSlot.denseIndex = COLLISION_PROXY_INVALID_DENSE_INDEX;
+        newSlot.generation = 0;
+        m_slots.push_back(newSlot);
+    }
+
+    const Collision_ProxyHandle handle = Collision_MakeProxyHandle(slot, m_slots[slot].generation);
+    m_slots[slot].denseIndex = static_cast<uint32_t>(m_dense.size());
+
+    Collision_SpatialProxy proxy;
+    proxy.entity = id;
+    proxy.worldAABB = aabb;
+    m_dense.push_back(proxy);
+    m_denseHandles.push_back(handle);
+
+    if (entityIndex >= m_handleByEntityIndex.size())
+    {
+        m_handleByEntityIndex.resize(entityIndex + 1, COLLISION_INVALID_PROXY_HANDLE);
     }
+    m_handleByEntityIndex[entityIndex] = handle;
+
+    return handle;
+}
 
-    m_proxies[id] = aabb;
+bool Collision_SpatialProxyRegistry::UpdateProxy(Collision_ProxyHandle handle, const Collision_AABB& aabb)
+{
+    const uint32_t denseIndex = FindDenseIndex(handle);
+    if (denseIndex == COLLISION_PROXY_INVALID_DENSE_INDEX)
+    {
+        return false;
+    }
+
+    if (!Collision_IsValidAABB(aabb))
+    {
+        SYSTEM_LOG << "[Collision] Collision_SpatialProxyRegistry ignored invalid AABB for entity="
+                   << m_dense[denseIndex].entity << std::endl;
+        return false;
+    }
+
+    m_dense[denseIndex].worldAABB = aabb;
+    return true;
+}
+
+void Collision_SpatialProxyRegistry::RegisterOrUpdateProxies(const Collision_SpatialProxy* proxies, size_t count)
+{
+    m_dense.reserve(m_dense.size() + count);
+    m_denseHandles.reserve(m_denseHandles.size() + count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        RegisterOrUpdateProxy(proxies[index].entity, proxies[index].worldAABB);
+    }
 }
 
 void Collision_SpatialProxyRegistry::RemoveProxy(EntityID id)
 {
-    m_proxies.erase(id);
+    const Collision_ProxyHandle handle = FindProxy(id);
+    if (handle == COLLISION_INVALID_PROXY_HANDLE)
+    {
+        return;
+    }
+
+    const uint32_t slot = handle & COLLISION_PROXY_SLOT_MASK;
+    const uint32_t removedIndex = m_slots[slot].denseIndex;
+    const uint32_t lastIndex = static_cast<uint32_t>(m_dense.size() - 1);
+
+    // Swap-and-pop keeps the array packed: the moved proxy's slot follows it
+    if (removedIndex != lastIndex)
+    {
+        m_dense[removedIndex] = m_dense[lastIndex];
+        m_denseHandles[removedIndex] = m_denseHandles[lastIndex];
+        m_slots[m_denseHandles[removedIndex] & COLLISION_PROXY_SLOT_MASK].denseIndex = removedIndex;
+    }
+
+    m_dense.pop_back();
+    m_denseHandles.pop_back();
+
+    // A slot whose generations are exhausted is retired: wrapping to 0 would let the
+    // handles it issued first validate again
+    m_slots[slot].denseIndex = COLLISION_PROXY_INVALID_DENSE_INDEX;
+    if (m_slots[slot].generation == COLLISION_PROXY_GENERATION_MASK)
+    {
+        ++m_retiredSlotCount;
+    }
+    else
+    {
+        ++m_slots[slot].generation;
+        m_freeSlots.push_back(slot);
+    }
+
+    m_handleByEntityIndex[GetEntityIndex(id)] = COLLISION_INVALID_PROXY_HANDLE;
 }
 
 void Collision_SpatialProxyRegistry::Clear()
 {
-    m_proxies.clear();
+    m_dense.clear();
+    m_denseHandles.clear();
+    m_slots.clear();
+    m_freeSlots.clear();
+    m_handleByEntityIndex.clear();
+    m_retiredSlotCount = 0;
+}
+
+Collision_ProxyHandle Collision_SpatialProxyRegistry::FindProxy(EntityID id) const
+{
+    const uint32_t entityIndex = GetEntityIndex(id);
+    if (entityIndex >= m_handleByEntityIndex.size())
+    {
+        return COLLISION_INVALID_PROXY_HANDLE;
+    }
+
+    // The dense back-reference rejects an older entity that had the same index
+    const Collision_ProxyHandle handle = m_handleByEntityIndex[entityIndex];
+    const uint32_t denseIndex = FindDenseIndex(handle);
+    if (denseIndex == COLLISION_PROXY_INVALID_DENSE_INDEX || m_dense[denseIndex].entity != id)
+    {
+        return COLLISION_INVALID_PROXY_HANDLE;
+    }
+
+    return handle;
+}
+
+const Collision_SpatialProxy* Collision_SpatialProxyRegistry::GetProxy(Collision_ProxyHandle handle) const
+{
+    const uint32_t denseIndex = FindDenseIndex(handle);
+    return (denseIndex != COLLISION_PROXY_INVALID_DENSE_INDEX) ? &m_dense[denseIndex] : 0;
+}
+
+size_t Collision_SpatialProxyRegistry::GetProxyCount() const
+{
+    return m_dense.size();
+}
+
+size_t Collision_SpatialProxyRegistry::GetRetiredSlotCount() const
+{
+    return m_retiredSlotCount;
+}
+
+Collision_SpatialProxySpan Collision_SpatialProxyRegistry::GetProxies() const
+{
+    Collision_SpatialProxySpan span;
+    span.data = m_dense.empty() ? 0 : &m_dense[0];
+    span.size = m_dense.size();
+    return span;
 }
 
 void Collision_SpatialProxyRegistry::GetSnapshot(std::vector<Collision_SpatialProxy>& out) const
 {
-    out.clear();
-    out.reserve(m_proxies.size());
+    // One contiguous copy of the dense array
+    out.assign(m_dense.begin(), m_dense.end());
+}
+
+uint32_t Collision_SpatialProxyRegistry::FindDenseIndex(Collision_ProxyHandle handle) const
+{
+    if (handle == COLLISION_INVALID_PROXY_HANDLE)
+    {
+        return COLLISION_PROXY_INVALID_DENSE_INDEX;
+    }
 
-    std::map<EntityID, Collision_AABB>::const_iterator it = m_proxies.begin();
-    for (; it != m_proxies.end(); ++it)
+    const uint32_t slot = handle & COLLISION_PROXY_SLOT_MASK;
+    if (slot >= m_slots.size() ||
+        m_slots[slot].generation != (handle >> COLLISION_PROXY_SLOT_BITS))
     {
-        Collision_SpatialProxy proxy;
-        proxy.entity = it->first;
-        proxy.worldAABB = it->second;
-        out.push_back(proxy);
+        return COLLISION_PROXY_INVALID_DENSE_INDEX;
     }
+
+    return m_slots[slot].denseIndex;
 }
 
 } // namespace Olympe
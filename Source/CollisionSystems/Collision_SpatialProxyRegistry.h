@@ -3,7 +3,8 @@
 #include "Collision_Primitives.h"
 #include "../ECS_Entity.h"
 
-#include <map>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace Olympe {
@@ -19,16 +20,98 @@ struct Collision_SpatialProxy
     }
 };
 
+// Stable reference to a registered proxy: [generation:12 | slot:20], like EntityID.
+// The generation changes when the slot is recycled, so stale handles are rejected; a slot
+// that used its last generation is retired. At most 2^20 - 1 slots are ever issued.
+typedef uint32_t Collision_ProxyHandle;
+const Collision_ProxyHandle COLLISION_INVALID_PROXY_HANDLE = 0xFFFFFFFFu;
+
+// Read-only view of the registry's dense proxy array (no copy).
+// Invalidated by any registration or removal.
+struct Collision_SpatialProxySpan
+{
+    const Collision_SpatialProxy* data;
+    size_t size;
+
+    Collision_SpatialProxySpan()
+        : data(0)
+        , size(0)
+    {
+    }
+
+    const Collision_SpatialProxy* begin() const { return data; }
+    const Collision_SpatialProxy* end() const { return data + size; }
+    bool empty() const { return size == 0; }
+    const Collision_SpatialProxy& operator[](size_t index) const { return data[index]; }
+};
+
+// Proxies packed in a dense array (swap-and-pop on removal), addressed through handles
+// whose slots come from a free list. Entities map to handles through a flat array indexed
+// by GetEntityIndex: registration, update and removal are O(1) with no hashing.
 class Collision_SpatialProxyRegistry
 {
 public:
-    void RegisterOrUpdateProxy(EntityID id, const Collision_AABB& aabb);
+    Collision_SpatialProxyRegistry();
+
+    // Returns the proxy's handle, or COLLISION_INVALID_PROXY_HANDLE when the AABB is
+    // invalid or every slot is in use (logged and ignored, a previous proxy of the entity is kept).
+    // A proxy of an older entity with the same index (recycled EntityID) is removed.
+    Collision_ProxyHandle RegisterOrUpdateProxy(EntityID id, const Collision_AABB& aabb);
+
+    // Update through a handle, without the entity lookup. False for a stale handle or an invalid AABB.
+    bool UpdateProxy(Collision_ProxyHandle handle, const Collision_AABB& aabb);
+
+    // Batched registration/update of 'count' proxies (same rules as RegisterOrUpdateProxy)
+    void RegisterOrUpdateProxies(const Collision_SpatialProxy* proxies, size_t count);
+
+    // Batched update from any range of entities, e.g. a ComponentView or view.Changed<T>():
+    // computeAABB(entity, outAABB) fills the box, or returns false to remove the entity's proxy.
+    template <typename EntityRange, typename ComputeAABB>
+    void UpdateProxies(const EntityRange& entities, ComputeAABB computeAABB)
+    {
+        for (EntityID entity : entities)
+        {
+            Collision_AABB aabb;
+            if (computeAABB(entity, aabb))
+            {
+                RegisterOrUpdateProxy(entity, aabb);
+            }
+            else
+            {
+                RemoveProxy(entity);
+            }
+        }
+    }
+
     void RemoveProxy(EntityID id);
     void Clear();
+
+    Collision_ProxyHandle FindProxy(EntityID id) const;
+    // nullptr for a stale handle. The pointer is invalidated by any registration or removal.
+    const Collision_SpatialProxy* GetProxy(Collision_ProxyHandle handle) const;
+    size_t GetProxyCount() const;
+    // Slots that used all their generations and are never reused
+    size_t GetRetiredSlotCount() const;
+
+    // Dense order: registration order, reshuffled by removals (not sorted by entity)
+    Collision_SpatialProxySpan GetProxies() const;
     void GetSnapshot(std::vector<Collision_SpatialProxy>& out) const;
 
 private:
-    std::map<EntityID, Collision_AABB> m_proxies;
+    struct Slot
+    {
+        uint32_t denseIndex;
+        uint32_t generation;
+    };
+
+    uint32_t FindDenseIndex(Collision_ProxyHandle handle) const;
+
+    std::vector<Collision_SpatialProxy> m_dense;
+    std::vector<Collision_ProxyHandle> m_denseHandles;      // Parallel to m_dense
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<Collision_ProxyHandle> m_handleByEntityIndex;
+    size_t m_retiredSlotCount;
 };
 
 } // namespace Olympe
@@ -125,6 +125,11 @@ bool DataManager::PreloadTexture(const std::string& id, const std::string& path,
         SDL_DestroySurface(surf);
     }
 
+    if (tex && category == ResourceCategory::GameEntity)
+    {
+        m_spriteAtlas_.Add(renderer, tex);
+    }
+
     m_resources_.emplace(id, res);
     SYSTEM_LOG << "DataManager: Loaded texture '" << id << "' from '" << path << "'\n";
     return true;
@@ -228,6 +233,7 @@ bool DataManager::ReleaseResource(const std::string& id)
 
     if (res->sprite_texture)
     {
+        m_spriteAtlas_.Remove(res->sprite_texture);
         SDL_DestroyTexture(res->sprite_texture);
         res->sprite_texture = nullptr;
     }
@@ -263,6 +269,27 @@ void DataManager::UnloadAll()
         }
     }
     m_resources_.clear();
+    m_spriteAtlas_.Clear();
+}
+//-------------------------------------------------------------
+bool DataManager::FindAtlasSprite(const Sprite* sprite, Sprite*& outPage, SDL_FRect& outRect) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex_);
+    Olympe::Rendering::AtlasRegion region;
+    if (!sprite || !m_spriteAtlas_.Find(sprite, region))
+    {
+        outPage = nullptr;
+        return false;
+    }
+    outPage = region.page;
+    outRect = region.rect;
+    return true;
+}
+//-------------------------------------------------------------
+void DataManager::RefreshSpriteAtlas()
+{
+    std::lock_guard<std::mutex> lock(m_mutex_);
+    m_spriteAtlas_.Refresh(GameEngine::renderer);
 }
 //-------------------------------------------------------------
 bool DataManager::HasResource(const std::string& id) const
@@ -31,6 +31,8 @@ Notes:
 #include <vector>
 #include <map>
 
+#include "Rendering/TextureAtlas.h"
+
 // File picker modal includes
 #include "Editor/Modals/FilePickerModal.h"
 #include "Editor/Modals/SaveFilePickerModal.h"
@@ -102,6 +104,12 @@ public:
     bool GetSpriteEditor_data(const std::string& id, const std::string& path, VisualEditor_data& outData); 
     bool ReleaseResource(const std::string& id);
 
+    // Sprite atlas: game entity sprites are copied into shared pages when they load,
+    // so the renderer can batch them (see Rendering/TextureAtlas.h)
+    bool FindAtlasSprite(const Sprite* sprite, Sprite*& outPage, SDL_FRect& outRect) const;
+    // Copy the sprites into the atlas pages again (SDL_EVENT_RENDER_TARGETS_RESET)
+    void RefreshSpriteAtlas();
+
 
     // Resource helpers
     void UnloadAll();
@@ -350,6 +358,7 @@ private:
     std::string name;
     mutable std::mutex m_mutex_;
     std::unordered_map<std::string, std::shared_ptr<Resource>> m_resources_;
+    Olympe::Rendering::TextureAtlas m_spriteAtlas_;
     bool m_enableFallbackScan = true;
 
     // Phase 40: Centralized file picker modals
@@ -0,0 +1,90 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+ECS Command Buffer purpose: Record structural changes (entity creation/destruction)
+while systems or views are being iterated, and play them back in bulk once per frame.
+The World owns one buffer and flushes it at the start of World::Process().
+Recording is thread-safe (one mutex): systems scheduled in parallel and
+View::ParallelForEach chunks may record into the same buffer. Commands recorded
+concurrently are played back in no particular order.
+
+Usage:
+    World::Get().GetCommandBuffer().DestroyEntity(e);
+    World::Get().GetCommandBuffer().CreateEntity([](EntityID e) {
+        World::Get().AddComponent<Position_data>(e);
+    });
+
+*/
+#pragma once
+
+#include "ECS_Entity.h"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+class EntityCommandBuffer
+{
+public:
+    // Called with the new entity once it has been created during the flush
+    using CreateCallback = std::function<void(EntityID)>;
+
+    // Queue an entity for destruction (duplicates and stale handles are ignored at flush time)
+    void DestroyEntity(EntityID entity)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingDestroys.push_back(entity);
+    }
+
+    // Queue an entity creation; the callback initializes its components
+    void CreateEntity(CreateCallback onCreated)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingCreates.push_back(std::move(onCreated));
+    }
+
+    bool empty() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pendingDestroys.empty() && m_pendingCreates.empty();
+    }
+
+    size_t GetPendingDestroyCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pendingDestroys.size();
+    }
+
+    size_t GetPendingCreateCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pendingCreates.size();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingDestroys.clear();
+        m_pendingCreates.clear();
+    }
+
+    // Move the recorded commands out (used by World::FlushCommandBuffer). The buffer is
+    // empty afterwards, so callbacks run by the caller can record commands for the next flush.
+    void TakeCommands(std::vector<CreateCallback>& outCreates, std::vector<EntityID>& outDestroys)
+    {
+        outCreates.clear();
+        outDestroys.clear();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        outCreates.swap(m_pendingCreates);
+        outDestroys.swap(m_pendingDestroys);
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<EntityID> m_pendingDestroys;
+    std::vector<CreateCallback> m_pendingCreates;
+};
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "ECS_Entity.h"
+#include "StringAtom.h"
 #include <string>
 #include <unordered_map>
 #include "vector.h"
@@ -111,6 +112,26 @@ struct Identity_data
 	
 	/** @brief Should the entity persist across levels? */
 	bool isPersistent = false;
+
+	/** @brief Interned tag, for integer compares in hot paths (see SyncAtoms) */
+	AtomID tagAtom = UntaggedAtom();
+
+	/** @brief Interned type, for integer compares in hot paths (see SyncAtoms) */
+	AtomID typeAtom = UnknownTypeAtom();
+
+	/** @brief Atom of the default tag (interned once, not per construction) */
+	static AtomID UntaggedAtom()
+	{
+		static const AtomID s_untagged = InternAtom("Untagged");
+		return s_untagged;
+	}
+
+	/** @brief Atom of the default type (interned once, not per construction) */
+	static AtomID UnknownTypeAtom()
+	{
+		static const AtomID s_unknownType = InternAtom("UnknownType");
+		return s_unknownType;
+	}
 	
 	/** @brief Default constructor */
 	Identity_data() = default;
@@ -122,7 +143,15 @@ struct Identity_data
 	 * @param et Entity type string
 	 */
 	Identity_data(std::string n, std::string t, std::string et)
-		: name(std::move(n)), tag(std::move(t)), type(std::move(et)), entityType(EntityType::None) {}
+		: name(std::move(n)), tag(std::move(t)), type(std::move(et)), entityType(EntityType::None),
+		  tagAtom(InternAtom(tag)), typeAtom(InternAtom(type)) {}
+
+	/** @brief Refresh the atoms after tag/type strings were modified (load time only) */
+	void SyncAtoms()
+	{
+		tagAtom = InternAtom(tag);
+		typeAtom = InternAtom(type);
+	}
 	
 	/** @brief Copy constructor */
 	Identity_data(const Identity_data&) = default;
@@ -131,6 +160,17 @@ struct Identity_data
 	Identity_data& operator=(const Identity_data&) = default;
 };
 
+/**
+ * @brief Tag component for UI entities (Identity type "UIElement")
+ *
+ * Added/removed by World when an Identity_data is added or refreshed, so the
+ * world RenderingSystem can exclude UI entities by signature and the
+ * UIRenderingSystem can require them, without string compares.
+ */
+struct UIElement_data
+{
+};
+
 /**
  * @brief Position component for spatial location
  * 
@@ -274,6 +314,12 @@ struct VisualSprite_data
 	Vector hotSpot;        // Hotspot offset for rendering
 	SDL_Color color = { 255, 255, 255, 255 }; // Color (RGBA)
 	bool visible = true;    // Is the entity visible
+
+	// Location of 'sprite' in the sprite atlas (see Rendering/TextureAtlas.h),
+	// resolved by the renderer whenever 'sprite' changes
+	Sprite* atlasSource = nullptr; // Sprite the atlas location was resolved for
+	Sprite* atlasPage = nullptr;   // Atlas page holding the sprite (nullptr: drawn from 'sprite')
+	SDL_FRect atlasRect = { 0, 0, 0, 0 }; // Whole sprite inside the atlas page
 	
 	// Constructors
 	VisualSprite_data() = default;
@@ -11,24 +11,228 @@ ECS Types purpose: Basic type definitions for the Entity-Component-System (ECS)
 */
 #pragma once
 
+#include <atomic>
 #include <cstdint>
-#include <bitset>
+#include <cstddef>
 #include <vector>
 #include <functional>
+#include <queue>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OLYMPE_SIGNATURE_SSE2 1
+#include <emmintrin.h>
+#endif
 
 // --- 1. Entity (Identity) ---
-// An Entity is just a unique ID.
-using EntityID = std::uint64_t;
+// An Entity is a 32-bit generational handle: [generation:12 | index:20].
+// The index addresses dense per-entity arrays directly; the generation is bumped
+// every time the index is recycled so stale handles are detected in O(1); a slot is
+// retired once its generation is exhausted, so a stale handle never matches a newer entity.
+using EntityID = std::uint32_t;
 // /*DEPRECATED LIMITATION*/ const EntityID MAX_ENTITIES = 5000;
-const EntityID INVALID_ENTITY_ID = 0; // Use 0 for invalid
+const EntityID INVALID_ENTITY_ID = 0; // Use 0 for invalid (index 0 is never allocated)
+
+const std::uint32_t ENTITY_INDEX_BITS = 20;
+const std::uint32_t ENTITY_GENERATION_BITS = 32 - ENTITY_INDEX_BITS;
+const std::uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;           // 1,048,575 live entities
+const std::uint32_t ENTITY_GENERATION_MASK = (1u << ENTITY_GENERATION_BITS) - 1; // 4096 handles per slot
+
+// Compact index of an entity, used as key by the sparse-set component pools
+inline std::uint32_t GetEntityIndex(EntityID entity)
+{
+    return entity & ENTITY_INDEX_MASK;
+}
+
+// Generation of the slot at the time the handle was issued
+inline std::uint32_t GetEntityGeneration(EntityID entity)
+{
+    return (entity >> ENTITY_INDEX_BITS) & ENTITY_GENERATION_MASK;
+}
+
+inline EntityID MakeEntityID(std::uint32_t index, std::uint32_t generation)
+{
+    return ((generation & ENTITY_GENERATION_MASK) << ENTITY_INDEX_BITS) | (index & ENTITY_INDEX_MASK);
+}
+
+// Issues and recycles generational handles (used by World).
+// Released indices are reused in FIFO order with their generation bumped. A slot whose
+// generation reaches ENTITY_GENERATION_MASK is retired instead of wrapping to 0.
+// Index 0 is reserved so that INVALID_ENTITY_ID never maps to a live entity.
+class EntityHandleAllocator
+{
+public:
+    EntityHandleAllocator() : m_slots(1), m_retiredCount(0) {}
+
+    // INVALID_ENTITY_ID when the index space is exhausted
+    EntityID Allocate()
+    {
+        std::uint32_t index;
+        if (!m_freeIndices.empty())
+        {
+            index = m_freeIndices.front();
+            m_freeIndices.pop();
+        }
+        else
+        {
+            if (m_slots.size() > ENTITY_INDEX_MASK)
+                return INVALID_ENTITY_ID;
+            index = static_cast<std::uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        m_slots[index].alive = true;
+        return MakeEntityID(index, m_slots[index].generation);
+    }
+
+    // False for a stale or invalid handle
+    bool Release(EntityID entity)
+    {
+        if (!IsValid(entity))
+            return false;
+
+        Slot& slot = m_slots[GetEntityIndex(entity)];
+        slot.alive = false;
+        if (slot.generation == ENTITY_GENERATION_MASK)
+        {
+            // Every generation has been handed out: never reuse this index
+            ++m_retiredCount;
+            return true;
+        }
+
+        ++slot.generation;
+        m_freeIndices.push(GetEntityIndex(entity));
+        return true;
+    }
+
+    bool IsValid(EntityID entity) const
+    {
+        const std::uint32_t index = GetEntityIndex(entity);
+        return index < m_slots.size()
+            && m_slots[index].alive
+            && m_slots[index].generation == GetEntityGeneration(entity);
+    }
+
+    // Indices handed out so far, including the reserved index 0 and retired slots
+    std::size_t GetSlotCount() const { return m_slots.size(); }
+    std::size_t GetRetiredCount() const { return m_retiredCount; }
+
+private:
+    struct Slot
+    {
+        std::uint32_t generation = 0;
+        bool alive = false;
+    };
+
+    std::vector<Slot> m_slots;
+    std::queue<std::uint32_t> m_freeIndices; // FIFO: spreads reuse over the free slots
+    std::size_t m_retiredCount;
+};
 
 // --- 2. Component (Data) ---
-// Each component type gets a unique ID (its index in the bitset).
+// Each component type gets a unique ID (its index in the signature), starting at 0.
 using ComponentTypeID = std::uint64_t;
-const ComponentTypeID MAX_COMPONENTS = 32; // Limits the number of component types
+const ComponentTypeID MAX_COMPONENTS = 128; // Limits the number of component types
 
 // The Signature: indicates which components an Entity possesses.
-using ComponentSignature = std::bitset<MAX_COMPONENTS>;
+// Fixed 128-bit mask stored as two 64-bit words, 16-byte aligned so the
+// match test used by systems and views is a single SSE2 AND + compare.
+// Keeps the std::bitset subset used by the engine (set/reset/test/&/==).
+class alignas(16) ComponentSignature
+{
+public:
+    static constexpr std::size_t WORD_COUNT = MAX_COMPONENTS / 64;
+
+    ComponentSignature() : m_words{ 0, 0 } {}
+
+    // Throws std::out_of_range for pos >= MAX_COMPONENTS, as std::bitset::set does
+    ComponentSignature& set(std::size_t pos, bool value = true)
+    {
+        if (pos >= MAX_COMPONENTS)
+            throw std::out_of_range("ComponentSignature::set: position out of range.");
+
+        const std::uint64_t bit = std::uint64_t(1) << (pos & 63);
+        if (value)
+            m_words[pos >> 6] |= bit;
+        else
+            m_words[pos >> 6] &= ~bit;
+        return *this;
+    }
+
+    ComponentSignature& reset(std::size_t pos) { return set(pos, false); }
+
+    ComponentSignature& reset()
+    {
+        m_words[0] = 0;
+        m_words[1] = 0;
+        return *this;
+    }
+
+    bool test(std::size_t pos) const
+    {
+        return pos < MAX_COMPONENTS && ((m_words[pos >> 6] >> (pos & 63)) & 1) != 0;
+    }
+
+    bool none() const { return (m_words[0] | m_words[1]) == 0; }
+    bool any() const { return !none(); }
+
+    std::size_t count() const
+    {
+        std::size_t n = 0;
+        for (std::size_t w = 0; w < WORD_COUNT; ++w)
+        {
+            for (std::uint64_t v = m_words[w]; v != 0; v &= v - 1)
+                ++n;
+        }
+        return n;
+    }
+
+    // True if every bit of 'required' is also set here: (*this & required) == required
+    bool Contains(const ComponentSignature& required) const
+    {
+#if defined(OLYMPE_SIGNATURE_SSE2)
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_words));
+        const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(required.m_words));
+        const __m128i missing = _mm_andnot_si128(a, r);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(missing, _mm_setzero_si128())) == 0xFFFF;
+#else
+        return ((required.m_words[0] & ~m_words[0]) | (required.m_words[1] & ~m_words[1])) == 0;
+#endif
+    }
+
+    // True if at least one bit is set in both signatures
+    bool Intersects(const ComponentSignature& other) const
+    {
+        return ((m_words[0] & other.m_words[0]) | (m_words[1] & other.m_words[1])) != 0;
+    }
+
+    ComponentSignature& operator&=(const ComponentSignature& other)
+    {
+        m_words[0] &= other.m_words[0];
+        m_words[1] &= other.m_words[1];
+        return *this;
+    }
+
+    ComponentSignature& operator|=(const ComponentSignature& other)
+    {
+        m_words[0] |= other.m_words[0];
+        m_words[1] |= other.m_words[1];
+        return *this;
+    }
+
+    friend ComponentSignature operator&(ComponentSignature a, const ComponentSignature& b) { return a &= b; }
+    friend ComponentSignature operator|(ComponentSignature a, const ComponentSignature& b) { return a |= b; }
+
+    friend bool operator==(const ComponentSignature& a, const ComponentSignature& b)
+    {
+        return a.m_words[0] == b.m_words[0] && a.m_words[1] == b.m_words[1];
+    }
+    friend bool operator!=(const ComponentSignature& a, const ComponentSignature& b) { return !(a == b); }
+
+private:
+    std::uint64_t m_words[WORD_COUNT];
+};
+static_assert(MAX_COMPONENTS == 128, "ComponentSignature stores exactly two 64-bit words");
 
 // Alias for the system update function
 using SystemUpdateFn = std::function<void(float)>;
@@ -43,12 +247,107 @@ public:
     virtual void RemoveComponent(EntityID entity) = 0;
 };
 
+// --- 4. Entity Set (packed membership list) ---
+// Dense array of entities + sparse array keyed on the entity index.
+// Used for system membership and cached views: insert/erase/contains are O(1)
+// and iteration streams over a contiguous array (no tree, no hashing).
+class EntitySet
+{
+public:
+    static constexpr std::uint32_t INVALID_POSITION = 0xFFFFFFFFu;
+
+    // Index-based iterator: stays valid if the set grows or shrinks during the loop.
+    // Entities inserted while iterating are not visited; iteration stops early if
+    // the set shrinks below the current position.
+    class const_iterator
+    {
+    public:
+        const_iterator(const EntitySet* set, size_t index) : m_set(set), m_index(index) {}
+        EntityID operator*() const { return m_set->m_dense[m_index]; }
+        const_iterator& operator++() { ++m_index; return *this; }
+        bool operator==(const const_iterator& other) const { return !(*this != other); }
+        bool operator!=(const const_iterator& other) const
+        {
+            return m_index != other.m_index && m_index < m_set->m_dense.size();
+        }
+    private:
+        const EntitySet* m_set;
+        size_t m_index;
+    };
+
+    // Returns true if the entity was added
+    bool insert(EntityID entity)
+    {
+        const std::uint32_t index = GetEntityIndex(entity);
+        if (index >= m_sparse.size())
+            m_sparse.resize(index + 1, static_cast<std::uint32_t>(INVALID_POSITION));
+        else if (count(entity))
+            return false;
+
+        m_sparse[index] = static_cast<std::uint32_t>(m_dense.size());
+        m_dense.push_back(entity);
+        return true;
+    }
+
+    // Swap-and-pop removal; returns the number of removed entities (0 or 1)
+    size_t erase(EntityID entity)
+    {
+        if (!count(entity))
+            return 0;
+
+        const std::uint32_t index = GetEntityIndex(entity);
+        const std::uint32_t position = m_sparse[index];
+        const EntityID last = m_dense.back();
+        m_dense[position] = last;
+        m_sparse[GetEntityIndex(last)] = position;
+        m_dense.pop_back();
+        m_sparse[index] = INVALID_POSITION;
+        return 1;
+    }
+
+    size_t count(EntityID entity) const
+    {
+        const std::uint32_t index = GetEntityIndex(entity);
+        if (index >= m_sparse.size())
+            return 0;
+        const std::uint32_t position = m_sparse[index];
+        return (position != INVALID_POSITION && m_dense[position] == entity) ? 1 : 0;
+    }
+
+    bool contains(EntityID entity) const { return count(entity) != 0; }
+
+    void clear()
+    {
+        for (EntityID entity : m_dense)
+            m_sparse[GetEntityIndex(entity)] = INVALID_POSITION;
+        m_dense.clear();
+    }
+
+    bool empty() const { return m_dense.empty(); }
+    size_t size() const { return m_dense.size(); }
+    const EntityID* data() const { return m_dense.data(); }
+    EntityID operator[](size_t position) const { return m_dense[position]; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_dense.size()); }
+
+private:
+    std::vector<EntityID> m_dense;        // Packed members
+    std::vector<std::uint32_t> m_sparse;  // Entity index -> position in m_dense
+};
+
 // --- Utility Functions for Type IDs ---
 // Static counter to assign a unique ID to each new component type
 inline ComponentTypeID GetComponentTypeID()
 {
-    static ComponentTypeID nextID = 1;
-    return nextID++;
+    static std::atomic<ComponentTypeID> nextID(0);
+    // Type IDs index the signature bits and World's pool table directly
+    const ComponentTypeID id = nextID++;
+    if (id >= MAX_COMPONENTS)
+    {
+        throw std::runtime_error("Too many component types: increase MAX_COMPONENTS.");
+    }
+    return id;
 }
 
 // Added templated GetComponentTypeID_Static to ensure a unique static typeID per component type
@@ -58,3 +357,25 @@ ComponentTypeID GetComponentTypeID_Static()
     static ComponentTypeID typeID = GetComponentTypeID();
     return typeID;
 }
+
+// --- Change Ticks ---
+// Global frame counter stamped on a component slot whenever it is written through a
+// mutable accessor (ComponentPool::Modify, World::Modify, ComponentView::Modify) or
+// added. World::Process advances it once per frame. Starts at 1: tick 0 means "never".
+using ChangeTick = std::uint32_t;
+
+inline std::atomic<ChangeTick>& ChangeTickCounter()
+{
+    static std::atomic<ChangeTick> tick(1);
+    return tick;
+}
+
+inline ChangeTick GetChangeTick()
+{
+    return ChangeTickCounter().load(std::memory_order_relaxed);
+}
+
+inline ChangeTick AdvanceChangeTick()
+{
+    return ++ChangeTickCounter();
+}
@@ -14,17 +14,28 @@
 #include <vector>
 #include <queue>
 
-// --- Component Pool Implementation (Contiguous Storage) ---
+// --- Component Pool Implementation (Paged Sparse Set) ---
+// Dense arrays hold the components contiguously (swap-and-pop keeps them packed),
+// a paged sparse array maps the compact entity index to the dense slot.
+// Lookups are two array reads: no hashing, no tree walk.
+// Each dense slot also carries the ChangeTick of its last write through Modify()/MarkChanged()
+// (or its insertion), so incremental systems can skip untouched components.
 template <typename T>
 class ComponentPool : public IComponentPool
 {
 public:
+    // Sparse pages hold 1024 slots each (4 KB per page)
+    static constexpr std::uint32_t SPARSE_PAGE_SHIFT = 10;
+    static constexpr std::uint32_t SPARSE_PAGE_SIZE = 1u << SPARSE_PAGE_SHIFT;
+    static constexpr std::uint32_t SPARSE_PAGE_MASK = SPARSE_PAGE_SIZE - 1;
+    static constexpr std::uint32_t INVALID_DENSE_INDEX = 0xFFFFFFFFu;
+
     // The actual data container (contiguous storage for cache efficiency)
     std::vector<T> m_data;
-    // Map from EntityID to index in the data vector
-    std::unordered_map<EntityID, size_t> m_entityToIndex;
     // Map from index to EntityID (needed for swap-and-pop)
     std::vector<EntityID> m_indexToEntity;
+    // Change tick of each dense slot (parallel to m_data)
+    std::vector<ChangeTick> m_changeTicks;
 
     ComponentPool()
     {
@@ -36,29 +47,31 @@ public:
     // Virtual function implementation: removes a component using swap-and-pop
     void RemoveComponent(EntityID entity) override
     {
-        if (!m_entityToIndex.count(entity)) return;
+        const std::uint32_t indexOfRemoved = FindDenseIndex(entity);
+        if (indexOfRemoved == INVALID_DENSE_INDEX) return;
 
-        size_t indexOfRemoved = m_entityToIndex[entity];
-        size_t indexOfLast = m_data.size() - 1;
+        const std::uint32_t indexOfLast = static_cast<std::uint32_t>(m_data.size() - 1);
 
         // Swap-and-pop optimization: maintains data contiguity
         if (indexOfRemoved != indexOfLast)
         {
             // 1. Move/Swap data in the vector
             m_data[indexOfRemoved] = std::move(m_data[indexOfLast]);
+            m_changeTicks[indexOfRemoved] = m_changeTicks[indexOfLast];
 
             // 2. Update the mapping for the moved Entity
             EntityID entityOfLast = m_indexToEntity[indexOfLast];
-            m_entityToIndex[entityOfLast] = indexOfRemoved;
+            SparseSlot(GetEntityIndex(entityOfLast)) = indexOfRemoved;
             m_indexToEntity[indexOfRemoved] = entityOfLast;
         }
 
         // 3. Remove the last element (which is the component to be deleted)
         m_data.pop_back();
         m_indexToEntity.pop_back();
+        m_changeTicks.pop_back();
 
         // 4. Clean up the mapping for the deleted Entity
-        m_entityToIndex.erase(entity);
+        SparseSlot(GetEntityIndex(entity)) = INVALID_DENSE_INDEX;
     }
 
     // Adds a component (T) for the given EntityID
@@ -66,33 +79,101 @@ public:
     template<typename... Args>
     void AddComponent(EntityID entity, Args&&... args)
     {
-        if (m_entityToIndex.count(entity)) return;
+        if (FindDenseIndex(entity) != INVALID_DENSE_INDEX) return;
 
-        size_t newIndex = m_data.size();
+        const std::uint32_t newIndex = static_cast<std::uint32_t>(m_data.size());
 
         m_data.emplace_back(std::forward<Args>(args)...);
         m_indexToEntity.push_back(entity);
-        m_entityToIndex[entity] = newIndex;
+        m_changeTicks.push_back(GetChangeTick());
+        SparseSlot(GetEntityIndex(entity)) = newIndex;
     }
 
     // Fast access to the component by EntityID
     T& GetComponent(EntityID entity)
     {
-        if (!m_entityToIndex.count(entity))
+        const std::uint32_t index = FindDenseIndex(entity);
+        if (index == INVALID_DENSE_INDEX)
         {
             throw std::runtime_error("Component not found for entity.");
         }
-        size_t index = m_entityToIndex[entity];
-        if (index >= m_data.size())
+        return m_data[index];
+    }
+
+    // Mutable access: same as GetComponent() but stamps the current change tick.
+    // Use it for writes that incremental systems must observe (e.g. moving a Position_data).
+    T& Modify(EntityID entity)
+    {
+        const std::uint32_t index = FindDenseIndex(entity);
+        if (index == INVALID_DENSE_INDEX)
         {
-            throw std::runtime_error("Component index out of range for entity.");
+            throw std::runtime_error("Component not found for entity.");
         }
-        T& component = m_data[index];
-        return component;
+        m_changeTicks[index] = GetChangeTick();
+        return m_data[index];
+    }
+
+    // Stamps the current change tick after an in-place write (no-op without the component)
+    void MarkChanged(EntityID entity)
+    {
+        const std::uint32_t index = FindDenseIndex(entity);
+        if (index != INVALID_DENSE_INDEX)
+            m_changeTicks[index] = GetChangeTick();
+    }
+
+    // Tick of the last recorded write, 0 when the entity has no component in this pool
+    ChangeTick GetChangedTick(EntityID entity) const
+    {
+        const std::uint32_t index = FindDenseIndex(entity);
+        return (index != INVALID_DENSE_INDEX) ? m_changeTicks[index] : 0;
+    }
+
+    // Non-throwing access: nullptr when the entity has no component in this pool
+    T* TryGetComponent(EntityID entity)
+    {
+        const std::uint32_t index = FindDenseIndex(entity);
+        return (index != INVALID_DENSE_INDEX) ? &m_data[index] : nullptr;
     }
 
     bool HasComponent(EntityID entity) const
     {
-        return m_entityToIndex.count(entity) > 0;
+        return FindDenseIndex(entity) != INVALID_DENSE_INDEX;
+    }
+
+    size_t Size() const { return m_data.size(); }
+
+    // Returns the dense slot of the entity, or INVALID_DENSE_INDEX
+    std::uint32_t FindDenseIndex(EntityID entity) const
+    {
+        const std::uint32_t entityIndex = GetEntityIndex(entity);
+        const std::uint32_t page = entityIndex >> SPARSE_PAGE_SHIFT;
+        if (page >= m_sparsePages.size() || !m_sparsePages[page])
+            return INVALID_DENSE_INDEX;
+
+        const std::uint32_t denseIndex = m_sparsePages[page][entityIndex & SPARSE_PAGE_MASK];
+        // The dense back-reference rejects slots owned by another entity
+        if (denseIndex == INVALID_DENSE_INDEX || m_indexToEntity[denseIndex] != entity)
+            return INVALID_DENSE_INDEX;
+
+        return denseIndex;
+    }
+
+private:
+    // Sparse pages are allocated on first use so large, scattered indices stay cheap
+    std::vector<std::unique_ptr<std::uint32_t[]>> m_sparsePages;
+
+    std::uint32_t& SparseSlot(std::uint32_t entityIndex)
+    {
+        const std::uint32_t page = entityIndex >> SPARSE_PAGE_SHIFT;
+        if (page >= m_sparsePages.size())
+            m_sparsePages.resize(page + 1);
+
+        if (!m_sparsePages[page])
+        {
+            m_sparsePages[page].reset(new std::uint32_t[SPARSE_PAGE_SIZE]);
+            std::fill(m_sparsePages[page].get(), m_sparsePages[page].get() + SPARSE_PAGE_SIZE,
+                      static_cast<std::uint32_t>(INVALID_DENSE_INDEX));
+        }
+        return m_sparsePages[page][entityIndex & SPARSE_PAGE_MASK];
     }
 };
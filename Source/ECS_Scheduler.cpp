@@ -0,0 +1,148 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+ECS Scheduler implementation: dependency graph construction and parallel dispatch.
+
+*/
+
+#include "ECS_Scheduler.h"
+#include "system/JobSystem.h"
+#include "system/system_utils.h"
+
+#include <algorithm>
+#include <thread>
+
+//---------------------------------------------------------------------------------------------
+bool ECS_Scheduler::Conflicts(const ECS_System& a, const ECS_System& b)
+{
+    // Undeclared systems are exclusive
+    if (!a.accessDeclared || !b.accessDeclared)
+        return true;
+
+    // Write/write and read/write hazards on any shared component type
+    if ((a.writeSignature & (b.readSignature | b.writeSignature)).any())
+        return true;
+    if ((b.writeSignature & a.readSignature).any())
+        return true;
+
+    return false;
+}
+//---------------------------------------------------------------------------------------------
+void ECS_Scheduler::Build(const std::vector<std::unique_ptr<ECS_System>>& systems)
+{
+    const size_t count = systems.size();
+    m_nodes.assign(count, Node());
+    m_roots.clear();
+
+    std::vector<size_t> level(count, 1);
+    m_criticalPathLength = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Node& node = m_nodes[i];
+        node.system = systems[i].get();
+        node.runOnMainThread = !node.system->accessDeclared || node.system->mainThreadOnly;
+
+        // Depend on every earlier conflicting system: registration order is preserved
+        // for all pairs whose relative order is observable
+        for (size_t j = 0; j < i; ++j)
+        {
+            if (Conflicts(*systems[j], *node.system))
+            {
+                m_nodes[j].dependents.push_back(i);
+                ++node.dependencyCount;
+                level[i] = std::max(level[i], level[j] + 1);
+            }
+        }
+
+        if (node.dependencyCount == 0)
+            m_roots.push_back(i);
+        m_criticalPathLength = std::max(m_criticalPathLength, level[i]);
+    }
+
+    m_pendingDependencies.reset(new std::atomic<std::uint32_t>[count]);
+    m_dirty = false;
+
+    SYSTEM_LOG << "ECS_Scheduler: " << count << " systems, " << m_criticalPathLength
+               << " dependency levels\n";
+}
+//---------------------------------------------------------------------------------------------
+void ECS_Scheduler::Run(const std::vector<std::unique_ptr<ECS_System>>& systems)
+{
+    if (m_dirty || m_nodes.size() != systems.size())
+        Build(systems);
+
+    if (m_nodes.empty())
+        return;
+
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+        m_pendingDependencies[i].store(m_nodes[i].dependencyCount);
+    m_remainingNodes.store(m_nodes.size());
+
+    for (size_t root : m_roots)
+        OnNodeReady(root);
+
+    // The main thread runs main-thread systems and helps with worker jobs until the frame is done
+    JobSystem& jobs = JobSystem::Get();
+    while (m_remainingNodes.load() > 0)
+    {
+        size_t nodeIndex = 0;
+        bool hasMainThreadNode = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+            if (!m_mainThreadReady.empty())
+            {
+                nodeIndex = m_mainThreadReady.back();
+                m_mainThreadReady.pop_back();
+                hasMainThreadNode = true;
+            }
+        }
+
+        if (hasMainThreadNode)
+            ExecuteNode(nodeIndex);
+        else if (!jobs.RunPendingJob())
+            std::this_thread::yield();
+    }
+}
+//---------------------------------------------------------------------------------------------
+void ECS_Scheduler::OnNodeReady(size_t nodeIndex)
+{
+    if (m_nodes[nodeIndex].runOnMainThread)
+    {
+        std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+        m_mainThreadReady.push_back(nodeIndex);
+        return;
+    }
+
+    JobSystem::Get().Submit([this, nodeIndex]() { ExecuteNode(nodeIndex); });
+}
+//---------------------------------------------------------------------------------------------
+void ECS_Scheduler::ExecuteNode(size_t nodeIndex)
+{
+    Node& node = m_nodes[nodeIndex];
+    try
+    {
+        node.system->Process();
+    }
+    catch (const std::exception& e)
+    {
+        // Never let an exception escape a worker: the frame would never complete
+        SYSTEM_LOG << "ECS_Scheduler: system " << nodeIndex << " threw: " << e.what() << "\n";
+    }
+    catch (...)
+    {
+        SYSTEM_LOG << "ECS_Scheduler: system " << nodeIndex << " threw a non-std exception\n";
+    }
+
+    for (size_t dependent : node.dependents)
+    {
+        if (m_pendingDependencies[dependent].fetch_sub(1) == 1)
+            OnNodeReady(dependent);
+    }
+
+    m_remainingNodes.fetch_sub(1);
+}
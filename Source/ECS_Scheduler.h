@@ -0,0 +1,76 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+ECS Scheduler purpose: Run the Process() step of the registered systems in parallel
+while keeping the results of the serial registration order.
+
+Each system declares the component types it reads and writes (ECS_System::Reads<T>()
+/ Writes<T>()). Two systems conflict when one writes a component the other reads or
+writes; the scheduler links every system to the earlier systems it conflicts with,
+which gives a dependency DAG. Systems whose dependencies are done are dispatched on
+the JobSystem, so non-conflicting systems run concurrently.
+
+Rules:
+- A system that declares nothing is exclusive: it waits for every earlier system,
+  and every later system waits for it. It runs alone, on the main thread.
+- A system flagged mainThreadOnly runs on the main thread (SDL calls, asset loading,
+  event posting) but still overlaps with non-conflicting worker systems.
+- Systems must not create/destroy entities or add/remove components while running in
+  parallel. Entity creation/destruction goes through World::GetCommandBuffer(), whose
+  recording is locked (safe from any worker) and which is flushed at the start of the
+  frame; components of the new entities are added by its creation callbacks.
+- An exception thrown by Process() is caught and logged: the frame still completes.
+
+*/
+#pragma once
+
+#include "ECS_Systems.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class ECS_Scheduler
+{
+public:
+    // Rebuild the dependency graph on the next Run() (systems added or access changed)
+    void Invalidate() { m_dirty = true; }
+
+    // Execute Process() for every system once. Returns when all systems are done.
+    void Run(const std::vector<std::unique_ptr<ECS_System>>& systems);
+
+    // Number of dependency levels of the current graph (1 = fully parallel, N = serial)
+    size_t GetCriticalPathLength() const { return m_criticalPathLength; }
+
+    // True if a and b may not run at the same time
+    static bool Conflicts(const ECS_System& a, const ECS_System& b);
+
+private:
+    struct Node
+    {
+        ECS_System* system = nullptr;
+        std::vector<size_t> dependents;   // Nodes waiting for this one
+        std::uint32_t dependencyCount = 0;
+        bool runOnMainThread = false;
+    };
+
+    void Build(const std::vector<std::unique_ptr<ECS_System>>& systems);
+    void OnNodeReady(size_t nodeIndex);
+    void ExecuteNode(size_t nodeIndex);
+
+    std::vector<Node> m_nodes;
+    std::vector<size_t> m_roots;
+    size_t m_criticalPathLength = 0;
+    bool m_dirty = true;
+
+    // Per-frame execution state
+    std::unique_ptr<std::atomic<std::uint32_t>[]> m_pendingDependencies;
+    std::atomic<size_t> m_remainingNodes{ 0 };
+    std::mutex m_mainThreadMutex;
+    std::vector<size_t> m_mainThreadReady;
+};
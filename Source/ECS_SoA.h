@@ -0,0 +1,199 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+ECS SoA purpose: Opt-in structure-of-arrays lanes for hot POD components.
+
+A component opts in by specializing ComponentLayout<T> (SoA = true, LANE_COUNT and
+Gather/Scatter of its float fields). The pool's AoS array stays the authoritative
+storage (GetComponent hands out T&). A batched kernel owns its lanes: SoALanes<T> is
+caller scratch holding one float array per lane, filled in view order from a pool,
+processed with SSE/AVX, and written back. Lanes are never shared between callers, so
+a system only touches the components its declared access covers.
+
+Typical batch (ranges may run in parallel, they touch disjoint lane slots):
+    positionLanes.Resize(count);
+    positionLanes.Gather(*positions, entities, begin, end);
+    SoAKernels::Integrate(positionLanes.Lane(0), velocityLanes.Lane(0), dt, begin, end);
+    positionLanes.Scatter(*positions, begin, end);
+
+Gather/scatter cost one copy each way: a kernel must do enough work per entity to pay
+for it. MovementSystem's pos += velocity * dt does not (measured slower than the AoS
+loop) and stays AoS.
+
+The kernels perform the same IEEE operations in the same order as the scalar AoS
+code (a * b, then + c, no fused multiply-add), so both paths are bit-identical.
+
+*/
+#pragma once
+
+#include "ECS_Register.h"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OLYMPE_SOA_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// --- Component layout trait ---
+// Default: plain array of structs
+template <typename T>
+struct ComponentLayout
+{
+    static constexpr bool SoA = false;
+};
+
+// Position lanes: position.x, position.y, position.z
+template <>
+struct ComponentLayout<Position_data>
+{
+    static constexpr bool SoA = true;
+    static constexpr size_t LANE_COUNT = 3;
+
+    static void Gather(const Position_data& c, float* const* lanes, size_t i)
+    {
+        lanes[0][i] = c.position.x;
+        lanes[1][i] = c.position.y;
+        lanes[2][i] = c.position.z;
+    }
+    static void Scatter(Position_data& c, const float* const* lanes, size_t i)
+    {
+        c.position.x = lanes[0][i];
+        c.position.y = lanes[1][i];
+        c.position.z = lanes[2][i];
+    }
+};
+
+// Movement lanes: velocity.x, velocity.y, velocity.z (direction is not used by the integrator)
+template <>
+struct ComponentLayout<Movement_data>
+{
+    static constexpr bool SoA = true;
+    static constexpr size_t LANE_COUNT = 3;
+
+    static void Gather(const Movement_data& c, float* const* lanes, size_t i)
+    {
+        lanes[0][i] = c.velocity.x;
+        lanes[1][i] = c.velocity.y;
+        lanes[2][i] = c.velocity.z;
+    }
+    static void Scatter(Movement_data& c, const float* const* lanes, size_t i)
+    {
+        c.velocity.x = lanes[0][i];
+        c.velocity.y = lanes[1][i];
+        c.velocity.z = lanes[2][i];
+    }
+};
+
+// --- Lane scratch ---
+template <typename T>
+class SoALanes
+{
+public:
+    using Layout = ComponentLayout<T>;
+    static constexpr size_t LANE_COUNT = Layout::LANE_COUNT;
+
+    static_assert(Layout::SoA, "Component does not opt in to SoA lanes");
+
+    // Size every lane for a batch of 'count' entities (call before dispatching ranges)
+    void Resize(size_t count)
+    {
+        for (size_t lane = 0; lane < LANE_COUNT; ++lane)
+        {
+            m_lanes[lane].resize(count);
+            m_lanePointers[lane] = m_lanes[lane].data();
+        }
+        m_denseIndices.resize(count);
+    }
+
+    float* Lane(size_t lane) { return m_lanePointers[lane]; }
+    const float* Lane(size_t lane) const { return m_lanePointers[lane]; }
+
+    // Copy the components of entities[begin, end) into lane slots [begin, end).
+    // Every entity must own the component (view contract).
+    void Gather(const ComponentPool<T>& pool, const EntityID* entities, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const std::uint32_t index = pool.FindDenseIndex(entities[i]);
+            m_denseIndices[i] = index;
+            Layout::Gather(pool.m_data[index], m_lanePointers, i);
+        }
+    }
+
+    // Write lane slots [begin, end) back to the components gathered from the same pool
+    // (no component added or removed in between). Only components whose lanes changed
+    // (bitwise) are written and stamped with the current change tick, so Changed<T>()
+    // views skip entities that did not move.
+    void Scatter(ComponentPool<T>& pool, size_t begin, size_t end) const
+    {
+        const ChangeTick tick = GetChangeTick();
+        float current[LANE_COUNT];
+        float* currentLanes[LANE_COUNT];
+        for (size_t lane = 0; lane < LANE_COUNT; ++lane)
+            currentLanes[lane] = &current[lane];
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            const std::uint32_t index = m_denseIndices[i];
+            Layout::Gather(pool.m_data[index], currentLanes, 0);
+
+            bool changed = false;
+            for (size_t lane = 0; lane < LANE_COUNT; ++lane)
+                changed = changed || std::memcmp(&current[lane], &m_lanePointers[lane][i], sizeof(float)) != 0;
+
+            if (changed)
+            {
+                Layout::Scatter(pool.m_data[index], m_lanePointers, i);
+                pool.m_changeTicks[index] = tick;
+            }
+        }
+    }
+
+private:
+    std::vector<float> m_lanes[LANE_COUNT];
+    float* m_lanePointers[LANE_COUNT] = {};
+    std::vector<std::uint32_t> m_denseIndices;   // Pool slot of each lane slot (set by Gather)
+};
+
+// --- Lane kernels ---
+namespace SoAKernels
+{
+    // value[i] = value[i] + rate[i] * dt for i in [begin, end)
+    inline void Integrate(float* value, const float* rate, float dt, size_t begin, size_t end)
+    {
+        size_t i = begin;
+#if defined(__AVX__)
+        const __m256 dt8 = _mm256_set1_ps(dt);
+        for (; i + 8 <= end; i += 8)
+        {
+            const __m256 step = _mm256_mul_ps(_mm256_loadu_ps(rate + i), dt8);
+            _mm256_storeu_ps(value + i, _mm256_add_ps(_mm256_loadu_ps(value + i), step));
+        }
+#endif
+#if defined(OLYMPE_SOA_SSE2)
+        const __m128 dt4 = _mm_set1_ps(dt);
+        for (; i + 4 <= end; i += 4)
+        {
+            const __m128 step = _mm_mul_ps(_mm_loadu_ps(rate + i), dt4);
+            _mm_storeu_ps(value + i, _mm_add_ps(_mm_loadu_ps(value + i), step));
+        }
+#endif
+        for (; i < end; ++i)
+        {
+            const float step = rate[i] * dt;
+            value[i] = value[i] + step;
+        }
+    }
+
+}
@@ -20,10 +20,12 @@ ECS Systems purpose: Define systems that operate on entities with specific compo
 #include "system/JoystickManager.h"
 #include "system/ViewportManager.h"
 #include "system/EventQueue.h"
+#include "system/JobSystem.h"
 #include "VideoGame.h"
 #include "system/GameMenu.h"
 #include "TiledLevelLoader/include/ParallaxLayerManager.h"
 #include "Rendering/IsometricRenderer.h"
+#include "Rendering/TileGeometry.h"
 #include "CollisionMap.h"
 #include <iostream>
 #include <bitset>
@@ -31,6 +33,7 @@ ECS Systems purpose: Define systems that operate on entities with specific compo
 #include <algorithm>
 #include <vector>
 #include <cfloat>
+#include <chrono>
 #include "drawing.h"
 #include "RenderContext.h"
 
@@ -408,6 +411,7 @@ AISystem::AISystem()
     requiredSignature.set(GetComponentTypeID_Static<Position_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<AIBehavior_data>(), true);
 	requiredSignature.set(GetComponentTypeID_Static<Movement_data>(), true);
+    DeclareNoComponentAccess(); // Stub: no processing yet
 }
 void AISystem::Process()
 {
@@ -420,6 +424,7 @@ void AISystem::Process()
 //-------------------------------------------------------------
 DetectionSystem::DetectionSystem()
 {
+    DeclareNoComponentAccess(); // Stub: no processing yet
 }
 void DetectionSystem::Process()
 {
@@ -432,6 +437,7 @@ void DetectionSystem::Process()
 //-------------------------------------------------------------
 PhysicsSystem::PhysicsSystem()
 {
+    DeclareNoComponentAccess(); // Stub: no processing yet
 }
 void PhysicsSystem::Process()
 {
@@ -442,20 +448,9 @@ void PhysicsSystem::Process()
     // Physics processing logic here
 }
 //-------------------------------------------------------------
-CollisionSystem::CollisionSystem()
-{
-}
-void CollisionSystem::Process()
-{
-    // Early return if no entities
-    if (m_entities.empty())
-        return;
-
-    // Collision processing logic here
-}
-//-------------------------------------------------------------
 TriggerSystem::TriggerSystem()
 {
+    DeclareNoComponentAccess(); // Stub: no processing yet
 }
 void TriggerSystem::Process()
 {
@@ -471,6 +466,10 @@ MovementSystem::MovementSystem()
     // Define the required components: Position AND AI_Player
     requiredSignature.set(GetComponentTypeID_Static<Position_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<Movement_data>(), true);
+
+    // Parallel scheduling
+    Reads<Movement_data>();
+    Writes<Position_data>();
 }
 
 void MovementSystem::Process()
@@ -479,22 +478,20 @@ void MovementSystem::Process()
     if (m_entities.empty())
         return;
 
-    // Iterate ONLY over the relevant entities stored in m_entities
-    for (EntityID entity : m_entities)
-    {
-        try
+    // Data-parallel over chunks of the cached view (each entity only touches its own components).
+    // Plain AoS loop: gathering SoA lanes costs more than this one multiply-add saves.
+    const float fDt = GameEngine::fDt;
+    auto view = World::Get().View<Position_data, Movement_data>();
+    view.ParallelForEach(
+        [fDt, &view](EntityID entity, Position_data& pos, const Movement_data& move)
         {
-            // Direct and fast access to Component data from the Pools
-            Position_data& pos = World::Get().GetComponent<Position_data>(entity);
-            Movement_data& move = World::Get().GetComponent<Movement_data>(entity);
             // Game logic: simple movement based on speed and delta time
-            pos.position += move.velocity * GameEngine::fDt;
-        }
-        catch (const std::exception& e)
-        {
-            std::cerr << "MovementSystem Error for Entity " << entity << ": " << e.what() << "\n";
-        }
-    }
+            const Vector previous = pos.position;
+            pos.position += move.velocity * fDt;
+            // Only moved entities show up in Changed<Position_data>() views
+            if (pos.position != previous)
+                view.MarkChanged<Position_data>(entity);
+        });
 }
 //-------------------------------------------------------------
 RenderingSystem::RenderingSystem()
@@ -504,116 +501,133 @@ RenderingSystem::RenderingSystem()
     requiredSignature.set(GetComponentTypeID_Static<Position_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<VisualSprite_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<BoundingBox_data>(), true);
+
+    // UI entities are drawn by UIRenderingSystem (Pass 2)
+    excludedSignature.set(GetComponentTypeID_Static<UIElement_data>(), true);
 }
+// Defined with the tile rendering helpers below
+static void BuildTileGeometryIfNeeded();
+
 void RenderingSystem::Render()
 {
     SDL_Renderer* renderer = GameEngine::renderer;
     if (!renderer) return;
 
-    // Get actual players from ViewportManager
-    const auto& players = ViewportManager::Get().GetPlayers();
-    
-    // Check if we have any ECS cameras active
-    // For multi-player: check player cameras
-    // For no-players: check default camera (playerId=-1)
-    bool hasECSCameras = false;
-    if (!players.empty())
+    const auto frameStart = std::chrono::steady_clock::now();
+    m_metrics.Reset();
+
+    // Active ECS cameras of this frame (no legacy fallback without them)
+    UpdateFrameViews();
+    if (m_views.empty())
+        return;
+
+    // Shared by every view: baked tile geometry, chunk index, entity sprites sorted by depth.
+    // Built here on the main thread: the views below only read them.
+    BuildTileGeometryIfNeeded();
+    World::Get().RebuildTileChunkIndexIfNeeded();
+    ExtractScene();
+    m_metrics.extractMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+    // Per-view culling, queue update and tile transforms. Views only read the shared data
+    // and write their own queue and tile vertex slot, so split-screen views run in parallel.
+    const bool parallel = m_views.size() > 1 && m_views.size() <= static_cast<size_t>(Olympe::Rendering::TileBlock::MAX_VIEWS);
+    JobSystem::Get().ParallelFor(m_views.size(), parallel ? 1 : m_views.size(), [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            PrepareMultiLayerForCamera(m_views[i], m_scene);
+    });
+
+    // Draw in player order (the renderer is single-threaded)
+    const bool multiPlayer = !ViewportManager::Get().GetPlayers().empty();
+    GridSystem* grid = World::Get().GetSystem<GridSystem>();
+    for (RenderView& view : m_views)
     {
-        // Multi-player case: check if any player has an active camera
-        for (short playerID : players)
-        {
-            CameraTransform camTransform = GetActiveCameraTransform(playerID);
-            if (camTransform.isActive)
-            {
-                hasECSCameras = true;
-                break;
-            }
-        }
+        const CameraTransform& camTransform = view.cam;
+
+        // Set active camera for drawing functions
+        RenderContext::Get().SetActiveCamera(camTransform);
+
+        // Set viewport and clip rect
+        SDL_Rect viewportRect = {
+            (int)camTransform.viewport.x,
+            (int)camTransform.viewport.y,
+            (int)camTransform.viewport.w,
+            (int)camTransform.viewport.h
+        };
+
+        SDL_SetRenderViewport(renderer, &viewportRect);
+        //SDL_SetRenderClipRect(renderer, &viewportRect);
+
+        if (multiPlayer && grid)
+            grid->RenderForCamera(camTransform);
+
+        // Render with parallax layers
+        const auto submitStart = std::chrono::steady_clock::now();
+        RenderMultiLayerForCamera(view);
+        m_metrics.submitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - submitStart).count();
+
+        // Clear active camera after rendering this view
+        RenderContext::Get().ClearActiveCamera();
     }
-    else
+
+    // Final reset
+    //SDL_SetRenderClipRect(renderer, nullptr);
+    SDL_SetRenderViewport(renderer, nullptr);
+
+    m_metrics.viewCount = m_views.size();
+    m_metrics.sceneSprites = m_scene.GetSprites().size();
+    for (const RenderView& view : m_views)
     {
-        // No-players case: check if default camera exists
-        CameraTransform defaultCam = GetActiveCameraTransform(-1);
-        hasECSCameras = defaultCam.isActive;
+        m_metrics.visibleSprites += view.queue->GetDynamicItems().size();
+        m_metrics.visibleBlocks += view.visibleBlocks.size();
+        m_metrics.drawCalls += view.drawCalls;
+        m_metrics.cullMs += view.cullMs;
+        m_metrics.sortMs += view.sortMs;
+        m_metrics.transformMs += view.transformMs;
     }
-    
-    // Use ECS camera system if available, otherwise fall back to legacy
-    if (hasECSCameras)
+    m_metrics.totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+}
+
+void RenderingSystem::UpdateFrameViews()
+{
+    // One camera lookup per player and frame
+    size_t count = 0;
+    auto addView = [this, &count](short playerID)
     {
-        if (!players.empty())
-        {
-            // Multi-camera rendering with ECS camera system
-            for (short playerID : players)
-            {
-                CameraTransform camTransform = GetActiveCameraTransform(playerID);
-                
-                if (!camTransform.isActive)
-                    continue;
-                
-                // Set active camera for drawing functions
-                RenderContext::Get().SetActiveCamera(camTransform);
-                
-                // Set viewport and clip rect
-                SDL_Rect viewportRect = {
-                    (int)camTransform.viewport.x,
-                    (int)camTransform.viewport.y,
-                    (int)camTransform.viewport.w,
-                    (int)camTransform.viewport.h
-                };
-
-                SDL_SetRenderViewport(renderer, &viewportRect);
-                //SDL_SetRenderClipRect(renderer, &viewportRect);
-                
-                GridSystem* grid = World::Get().GetSystem<GridSystem>();
-                if (grid)
-                    grid->RenderForCamera(camTransform);
+        CameraTransform cam = GetActiveCameraTransform(playerID);
+        if (!cam.isActive)
+            return;
 
-                // Render with parallax layers
-                RenderMultiLayerForCamera(camTransform);
-                
-                // Clear active camera after rendering this player
-                RenderContext::Get().ClearActiveCamera();
-                
-                // Reset viewport-specific state
-                //SDL_SetRenderClipRect(renderer, nullptr);
+        if (count == m_views.size())
+            m_views.emplace_back();
+        RenderView& view = m_views[count];
+        view.playerID = playerID;
+        view.cam = cam;
+        view.tileView = static_cast<int>(count % Olympe::Rendering::TileBlock::MAX_VIEWS);
+        view.queue = &GetRenderQueue(playerID);
+
+        view.tileCamera.worldX = cam.worldPosition.x;
+        view.tileCamera.worldY = cam.worldPosition.y;
+        view.tileCamera.zoom = cam.zoom;
+        view.tileCamera.rotation = cam.rotation;
+        view.tileCamera.offsetX = cam.screenOffset.x;
+        view.tileCamera.offsetY = cam.screenOffset.y;
+        view.tileCamera.viewportW = cam.viewport.w;
+        view.tileCamera.viewportH = cam.viewport.h;
+        ++count;
+    };
 
-            }
-        }
-        else
-        {
-            // Single-view rendering with default camera (playerId=-1)
-            CameraTransform camTransform = GetActiveCameraTransform(-1);
-            if (camTransform.isActive)
-            {
-                // Set active camera for drawing functions
-                RenderContext::Get().SetActiveCamera(camTransform);
-                
-                // Set viewport and clip rect
-                SDL_Rect viewportRect = {
-                    (int)camTransform.viewport.x,
-                    (int)camTransform.viewport.y,
-                    (int)camTransform.viewport.w,
-                    (int)camTransform.viewport.h
-                };
-
-                SDL_SetRenderViewport(renderer, &viewportRect);
-                //SDL_SetRenderClipRect(renderer, &viewportRect);
-                
-                // Render with parallax layers
-                RenderMultiLayerForCamera(camTransform);
-                
-                // Clear active camera after rendering
-                RenderContext::Get().ClearActiveCamera();
-                
-                // Reset viewport-specific state
-                //SDL_SetRenderClipRect(renderer, nullptr);
-            }
-        }
-        
-        // Final reset
-        //SDL_SetRenderClipRect(renderer, nullptr);
-        SDL_SetRenderViewport(renderer, nullptr);
+    // Player cameras, or the default camera (playerId=-1) without players
+    const auto& players = ViewportManager::Get().GetPlayers();
+    if (!players.empty())
+    {
+        for (short playerID : players)
+            addView(playerID);
     }
+    else
+    {
+        addView(-1);
+    }
+    m_views.resize(count);
 }
 
 // ========================================================================
@@ -632,36 +646,13 @@ namespace {
     constexpr int ORTHO_TILE_PADDING = 2;  // Padding for orthogonal tiles
 }
 
-// -> Helper: Extract flip flags from GID
-void ExtractFlipFlags(uint32_t gid, bool& flipH, bool& flipV, bool& flipD)
-{
-    constexpr uint32_t FLIPPED_HORIZONTALLY_FLAG = 0x80000000;
-    constexpr uint32_t FLIPPED_VERTICALLY_FLAG = 0x40000000;
-    constexpr uint32_t FLIPPED_DIAGONALLY_FLAG = 0x20000000;
-    
-    flipH = (gid & FLIPPED_HORIZONTALLY_FLAG) != 0;
-    flipV = (gid & FLIPPED_VERTICALLY_FLAG) != 0;
-    flipD = (gid & FLIPPED_DIAGONALLY_FLAG) != 0;
-}
-
-// -> Helper: Convert flip flags to SDL flip mode
-// Note: SDL3 only supports horizontal and vertical flips
-// Diagonal flip (flipD) is extracted but not applied - requires rotation
-SDL_FlipMode GetSDLFlip(bool flipH, bool flipV, bool /*flipD*/)
-{
-    int flip = SDL_FLIP_NONE;
-    if (flipH) flip |= SDL_FLIP_HORIZONTAL;
-    if (flipV) flip |= SDL_FLIP_VERTICAL;
-    return static_cast<SDL_FlipMode>(flip);
-}
-
 // -> NEW: Calculate visible tile range with frustum culling
 void GetVisibleTileRange(const CameraTransform& cam,
-                        const std::string& orientation,
+                        Olympe::Rendering::TileMapOrientation orientation,
                         int tileWidth, int tileHeight,
                         int& minX, int& minY, int& maxX, int& maxY)
 {
-    if (orientation == "isometric") {
+    if (orientation == Olympe::Rendering::TileMapOrientation::Isometric) {
         // Convert screen corners to world coordinates using CameraTransform::ScreenToWorld()
         Vector topLeftWorld = cam.ScreenToWorld(Vector(0, 0, 0));
         Vector topRightWorld = cam.ScreenToWorld(Vector(cam.viewport.w, 0));
@@ -721,14 +712,14 @@ void GetVisibleTileRange(const CameraTransform& cam,
 }
 
 // -> NEW: Calculate depth for a tile
-float CalculateTileDepth(const std::string& orientation,
+float CalculateTileDepth(Olympe::Rendering::TileMapOrientation orientation,
                         int worldX, int worldY,
                         int layerZOrder,
                         int tileWidth, int tileHeight)
 {
     float baseDepth = static_cast<float>(layerZOrder) * DEPTH_LAYER_SCALE;
     
-    if (orientation == "isometric") {
+    if (orientation == Olympe::Rendering::TileMapOrientation::Isometric) {
         // Isometric diagonal sort: X+Y then X
         int diagonalSum = worldX + worldY;
         return baseDepth + diagonalSum * DEPTH_DIAGONAL_SCALE + worldX * DEPTH_X_SCALE;
@@ -757,180 +748,124 @@ float CalculateEntityDepth(const std::string& orientation,
     }
 }
 
-// -> NEW: Render individual tile immediately (unified for all orientations)
-void RenderTileImmediate(SDL_Texture* texture, const SDL_Rect& srcRect,
-                        int worldX, int worldY, uint32_t gid,
-                        int tileoffsetX, int tileoffsetY,
-                        const CameraTransform& cam,
-                        const std::string& orientation,
-                        int tileWidth, int tileHeight)
+// Bake the static tile layers into per-block vertex batches (once per level)
+// (one SDL_RenderGeometry call per texture run and depth band)
+static void BuildTileGeometryIfNeeded()
 {
-    if (!texture) return;
-    
-    // Extract flip flags
-    bool flipH, flipV, flipD;
-    ExtractFlipFlags(gid, flipH, flipV, flipD);
-    SDL_FlipMode flip = GetSDLFlip(flipH, flipV, flipD);
-    
-    SDL_FRect srcFRect = {(float)srcRect.x, (float)srcRect.y, 
-                         (float)srcRect.w, (float)srcRect.h};
-    
-    // Calculate world position for this tile (orientation-specific)
-    Vector worldPos;
-    
-    if (orientation == "isometric") {
-        // Convert tile coordinates to isometric world coordinates
-        // Uses the standard isometric projection formula
-        float isoX = (worldX - worldY) * (tileWidth / 2.0f);
-        float isoY = (worldX + worldY) * (tileHeight / 2.0f);
-        
-        // Tiles use standard isometric projection with origin at tile (0,0)
-        // Objects are transformed from TMJ coordinates to match this system
-        // (see TransformObjectPosition in TiledToOlympe.cpp)
-        worldPos = Vector(isoX, isoY, 0.0f);
-    }
-    else if (orientation == "hexagonal") {
-        // Hexagonal axial to world (pointy-top)
-        float hexRadius = tileWidth / 2.0f;
-        float worldXPos = hexRadius * (sqrtf(3.0f) * worldX + sqrtf(3.0f) / 2.0f * worldY);
-        float worldYPos = hexRadius * (3.0f / 2.0f * worldY);
-        worldPos = Vector(worldXPos, worldYPos, 0.0f);
-    }
-    else {
-        // Orthogonal
-        worldPos = Vector((float) worldX * tileWidth, (float) worldY * tileHeight, 0.0f);
-    }
-    
-    // Calculate screen position with zoom only (no rotation)
-    // Rotation is applied separately via SDL_RenderTextureRotated with viewport-centered pivot
-    float screenX = (worldPos.x - cam.worldPosition.x) * cam.zoom - cam.screenOffset.x + cam.viewport.w / 2.0f;
-    float screenY = (worldPos.y - cam.worldPosition.y) * cam.zoom - cam.screenOffset.y + cam.viewport.h / 2.0f;
-    
-    // Tile offsets are in pixel/texture space, scale by zoom
-    float offsetScreenX = tileoffsetX * cam.zoom;
-    float offsetScreenY = tileoffsetY * cam.zoom;
-    
-    // Calculate destination rectangle
-    SDL_FRect destRect;
-    destRect.w = srcRect.w * cam.zoom;
-    destRect.h = srcRect.h * cam.zoom;
-    
-    if (orientation == "isometric") {
-        // Isometric: center tile horizontally, anchor at bottom
-        destRect.x = screenX + offsetScreenX - destRect.w / 2.0f;
-        destRect.y = screenY + offsetScreenY - destRect.h + (tileHeight * cam.zoom);
-    }
-    else {
-        // Orthogonal/hex: top-left anchor
-        // NOTE: Hexagonal tiles may require centered anchoring in the future
-        // depending on the specific hex tileset and map configuration
-        destRect.x = screenX + offsetScreenX;
-        destRect.y = screenY + offsetScreenY;
+    Olympe::Rendering::TileGeometry& tileGeometry = World::Get().GetTileGeometry();
+    if (tileGeometry.IsBuilt())
+        return;
+
+    const Olympe::Rendering::TileMapOrientation mapOrientation = World::Get().GetMapOrientationType();
+    int tileWidth = World::Get().GetTileWidth();
+    int tileHeight = World::Get().GetTileHeight();
+    const TilesetManager& tilesetMgr = World::Get().GetTilesetManager();
+    tileGeometry.Build(World::Get().GetTileChunks(), mapOrientation, tileWidth, tileHeight,
+        [&tilesetMgr](uint32_t gid, SDL_Texture*& texture, SDL_Rect& srcRect, int& offsetX, int& offsetY) {
+            const TilesetManager::TileLookup tile = tilesetMgr.FindTile(gid);
+            if (!tile.texture) return false;
+            texture = tile.texture;
+            srcRect = tile.srcRect;
+            offsetX = tile.tileset ? tile.tileset->tileoffsetX : 0;
+            offsetY = tile.tileset ? tile.tileset->tileoffsetY : 0;
+            return true;
+        },
+        [mapOrientation, tileWidth, tileHeight](int worldX, int worldY, int zOrder) {
+            return CalculateTileDepth(mapOrientation, worldX, worldY, zOrder, tileWidth, tileHeight);
+        });
+}
+
+// Extract the visible entity sprites once per frame, for every view
+void RenderingSystem::ExtractScene()
+{
+    m_scene.Clear();
+    for (EntityID entity : m_entities) {
+        try {
+            Position_data& pos = World::Get().GetComponent<Position_data>(entity);
+            VisualSprite_data& visual = World::Get().GetComponent<VisualSprite_data>(entity);
+            BoundingBox_data& bbox = World::Get().GetComponent<BoundingBox_data>(entity);
+            
+            // UI entities never enter RenderingSystem (excluded by UIElement_data tag)
+            
+            if (!visual.visible) continue;
+            
+            Olympe::Rendering::SceneSprite sprite;
+            sprite.entity = entity;
+            
+            // -> Calculate depth
+            sprite.depth = pos.zOrder * DEPTH_LAYER_SCALE;
+            sprite.depth += pos.position.y;
+            sprite.key = Olympe::Rendering::DepthSortKey(sprite.depth);
+            
+            // Frustum culling box (tested by each view)
+            sprite.worldBounds = {
+                pos.position.x - visual.hotSpot.x,
+                pos.position.y - visual.hotSpot.y,
+                bbox.boundingBox.w,
+                bbox.boundingBox.h
+            };
+            sprite.worldX = pos.position.x;
+            sprite.worldY = pos.position.y;
+            sprite.hotSpotX = visual.hotSpot.x;
+            sprite.hotSpotY = visual.hotSpot.y;
+            sprite.color = visual.color;
+            
+            if (visual.sprite) {
+                // Resolve the atlas location once per sprite change (animations swap sprites)
+                if (visual.atlasSource != visual.sprite) {
+                    DataManager::Get().FindAtlasSprite(visual.sprite, visual.atlasPage, visual.atlasRect);
+                    visual.atlasSource = visual.sprite;
+                }
+                if (visual.atlasPage) {
+                    sprite.texture = visual.atlasPage;
+                    sprite.srcRect = visual.atlasRect;
+                } else {
+                    // Whole texture, as RenderSingleEntity draws it
+                    sprite.texture = visual.sprite;
+                    sprite.srcRect = { 0.0f, 0.0f, static_cast<float>(visual.sprite->w), static_cast<float>(visual.sprite->h) };
+                }
+            }
+            
+            m_scene.Add(sprite);
+            
+        } catch (...) {}
     }
     
-    // Rotate around viewport center (not tile center!)
-    // Pivot point is the viewport center expressed in the tile's local coordinate system
-    SDL_FPoint pivotInTileSpace = {
-        cam.viewport.w / 2.0f - destRect.x,
-        cam.viewport.h / 2.0f - destRect.y
-    };
-    
-    SDL_RenderTextureRotated(GameEngine::renderer, texture, 
-                            &srcFRect, &destRect, 
-                            cam.rotation,        // Camera rotation angle
-                            &pivotInTileSpace,   // Pivot = viewport center in tile space
-                            flip);               // Flip flags
+    // -> Sorted once: the sprites each view keeps are already in depth order
+    m_scene.Sort();
 }
 
-// -> UNIFIED RENDERING PIPELINE - Single-pass sorting with frustum culling
-// Multi-layer rendering with parallax support
-void RenderMultiLayerForCamera(const CameraTransform& cam)
+// -> UNIFIED RENDERING PIPELINE - Persistent render queue with frustum culling
+// Multi-layer rendering with parallax support, in two steps per view:
+// PrepareMultiLayerForCamera (culling, sorting, tile transforms: no renderer access, runs
+// in parallel across views) then RenderMultiLayerForCamera (draw calls, main thread)
+void PrepareMultiLayerForCamera(RenderView& view, const Olympe::Rendering::RenderScene& scene)
 {
+    using Olympe::Rendering::RenderItem;
+    
+    const CameraTransform& cam = view.cam;
+    Olympe::Rendering::RenderQueue& queue = *view.queue;
+    const auto cullStart = std::chrono::steady_clock::now();
     Olympe::Tiled::ParallaxLayerManager& parallaxMgr = Olympe::Tiled::ParallaxLayerManager::Get();
-    const std::string& mapOrientation = World::Get().GetMapOrientation();
+    const Olympe::Rendering::TileMapOrientation mapOrientation = World::Get().GetMapOrientationType();
     int tileWidth = World::Get().GetTileWidth();
     int tileHeight = World::Get().GetTileHeight();
     
-    // Unified RenderItem structure for all renderable elements
-    struct RenderItem
-    {
-        enum Type { 
-            ParallaxLayer,    // Image layers (backgrounds/foregrounds)
-            IndividualTile,   // -> NEW: Individual tile with full data
-            Entity            // Game objects
-        } type;
-        
-        float depth;          // Unified sorting key (lower = background)
-        
-        // Type-specific data
-        union {
-            struct {
-                int layerIndex;
-            } parallax;
-            
-            struct {
-                // -> Complete tile data for immediate rendering
-                SDL_Texture* texture;
-                SDL_Rect srcRect;
-                int worldX, worldY;
-                uint32_t gid;
-                int tileoffsetX; int tileoffsetY;
-                int zOrder;
-            } tile;
-            
-            struct {
-                EntityID entityId;
-            } entity;
-        };
-        
-        // Factory methods
-        static RenderItem MakeParallax(float depth, int layerIndex) {
-            RenderItem item;
-            item.type = ParallaxLayer;
-            item.depth = depth;
-            item.parallax.layerIndex = layerIndex;
-            return item;
-        }
-        
-        static RenderItem MakeTile(float depth, 
-                                   SDL_Texture* tex, SDL_Rect src,
-                                   int wx, int wy, uint32_t gid,
-                                   int offX, int offY, int z) {
-            RenderItem item;
-            item.type = IndividualTile;
-            item.depth = depth;
-            item.tile.texture = tex;
-            item.tile.srcRect = src;
-            item.tile.worldX = wx;
-            item.tile.worldY = wy;
-            item.tile.gid = gid;
-            item.tile.tileoffsetX = offX;
-            item.tile.tileoffsetY = offY;
-            item.tile.zOrder = z;
-            return item;
-        }
-        
-        static RenderItem MakeEntity(float depth, EntityID id) {
-            RenderItem item;
-            item.type = Entity;
-            item.depth = depth;
-            item.entity.entityId = id;
-            return item;
-        }
-    };
-    
-    std::vector<RenderItem> renderBatch;
-    renderBatch.reserve(1000);  // Reserve for typical visible items (parallax + ~200-400 tiles + entities)
-    
     // ================================================================
     // PHASE 1: FRUSTUM CULLING + POPULATION
     // ================================================================
     
-    // 1.1 Parallax Layers (always visible)
+    // 1.1 Baked tile geometry (built by RenderingSystem before the views)
+    Olympe::Rendering::TileGeometry& tileGeometry = World::Get().GetTileGeometry();
+    
+    // Static items (parallax layers, tile blocks): only re-sorted when the visible set changes
+    queue.BeginStatic(tileGeometry.GetGeneration());
+    
+    // 1.2 Parallax Layers (skipped when scrolled out of this camera's viewport)
     const auto& parallaxLayers = parallaxMgr.GetLayers();
     for (size_t i = 0; i < parallaxLayers.size(); ++i) {
         const auto& layer = parallaxLayers[i];
-        if (!layer.visible) continue;
+        if (!parallaxMgr.IsLayerVisible(layer, cam)) continue;
         
         float depth;
         if (layer.scrollFactorX < 1.0f || layer.zOrder < 0) {
@@ -944,127 +879,109 @@ void RenderMultiLayerForCamera(const CameraTransform& cam)
             depth = static_cast<float>(layer.zOrder);
         }
         
-        renderBatch.push_back(RenderItem::MakeParallax(depth, static_cast<int>(i)));
+        queue.AddStaticItem(RenderItem::MakeParallax(depth, static_cast<int>(i)));
     }
     
-    // 1.2 Tiles (with -> FRUSTUM CULLING)
-    const auto& tileChunks = World::Get().GetTileChunks();
-    auto& tilesetMgr = World::Get().GetTilesetManager();
-    
+    // 1.3 Tiles (baked blocks, with -> FRUSTUM CULLING)
     // -> Calculate visible tile range
-    int minX, minY, maxX, maxY;
+    TileRect visibleRange;
     GetVisibleTileRange(cam, mapOrientation, tileWidth, tileHeight, 
-                        minX, minY, maxX, maxY);
+                        visibleRange.minX, visibleRange.minY, visibleRange.maxX, visibleRange.maxY);
     
-    for (const auto& chunk : tileChunks) {
-        for (int y = 0; y < chunk.height; ++y) {
-            for (int x = 0; x < chunk.width; ++x) {
-                int worldX = chunk.x + x;
-                int worldY = chunk.y + y;
-                
-                // -> FRUSTUM CULLING
-                if (worldX < minX || worldX > maxX || 
-                    worldY < minY || worldY > maxY) {
-                    continue;
-                }
-                
-                int tileIndex = y * chunk.width + x;
-                if (tileIndex >= chunk.tileGIDs.size()) continue;
-                
-                uint32_t gid = chunk.tileGIDs[tileIndex];
-                if (gid == 0) continue;
-                
-                // Get texture
-                SDL_Texture* texture = nullptr;
-                SDL_Rect srcRect;
-                const TilesetManager::TilesetInfo* tileset = nullptr;
-                if (!tilesetMgr.GetTileTexture(gid, texture, srcRect, tileset)) {
-                    continue;
-                }
-                
-                // -> Calculate depth
-                float depth = CalculateTileDepth(mapOrientation, 
-                                                worldX, worldY, 
-                                                chunk.zOrder,
-                                                tileWidth, tileHeight);
-                
-                // -> Add to batch
-                renderBatch.push_back(RenderItem::MakeTile(
-                    depth, texture, srcRect, 
-                    worldX, worldY, gid,
-                    tileset ? tileset->tileoffsetX : 0,
-                    tileset ? tileset->tileoffsetY : 0,
-                    chunk.zOrder
-                ));
-            }
-        }
+    // -> Chunk-level then block-level culling
+    // Flat blocks alone in their depth range are drawn from the render-to-texture cache
+    // (decided by the queue, see RenderQueue.h)
+    tileGeometry.CollectVisibleBlocks(World::Get().GetTileChunkIndex(), visibleRange, view.visibleBlocks, view.chunkScratch);
+    for (Olympe::Rendering::TileBlock* block : view.visibleBlocks) {
+        queue.AddStaticBlock(block);
     }
+    queue.EndStatic();
     
-    // 1.3 Entities (with -> FRUSTUM CULLING)
-    for (EntityID entity : World::Get().GetSystem<RenderingSystem>()->m_entities) {
-        try {
-            Position_data& pos = World::Get().GetComponent<Position_data>(entity);
-            VisualSprite_data& visual = World::Get().GetComponent<VisualSprite_data>(entity);
-            BoundingBox_data& bbox = World::Get().GetComponent<BoundingBox_data>(entity);
-            
-            // -> NEW: Skip UI entities (rendered in Pass 2)
-            if (World::Get().HasComponent<Identity_data>(entity))
-            {
-                Identity_data& id = World::Get().GetComponent<Identity_data>(entity);
-                if (id.type == "UIElement")
-                    continue;  // Skip UI, will be rendered in UIRenderingSystem
-            }
-            
-            if (!visual.visible) continue;
-            
-            // -> FRUSTUM CULLING
-            SDL_FRect worldBounds = {
-                pos.position.x - visual.hotSpot.x,
-                pos.position.y - visual.hotSpot.y,
-                bbox.boundingBox.w,
-                bbox.boundingBox.h
-            };
-            if (!cam.IsVisible(worldBounds)) continue;
-            
-            // -> Calculate depth
-            float depth = pos.zOrder * DEPTH_LAYER_SCALE;
-            depth += (mapOrientation == "isometric") ? pos.position.y : pos.position.y;
-            
-            renderBatch.push_back(RenderItem::MakeEntity(depth, entity));
-            
-        } catch (...) {}
+    // 1.4 Entities (shared scene, with -> FRUSTUM CULLING)
+    queue.ClearDynamic();
+    for (const Olympe::Rendering::SceneSprite& sprite : scene.GetSprites()) {
+        if (!cam.IsVisible(sprite.worldBounds)) continue;
+        queue.AddDynamic(RenderItem::MakeSprite(sprite));
     }
     
+    const auto sortStart = std::chrono::steady_clock::now();
+    view.cullMs = std::chrono::duration<double, std::milli>(sortStart - cullStart).count();
+    
     // ================================================================
-    // PHASE 2: -> UNIFIED SORT (SINGLE PASS!)
+    // PHASE 2: -> DYNAMIC SORT (static items are already sorted,
+    // entities come in scene order: only checked)
     // ================================================================
-    std::sort(renderBatch.begin(), renderBatch.end(),
-        [](const RenderItem& a, const RenderItem& b) {
-            return a.depth < b.depth;
-        });
+    queue.SortDynamic();
+    
+    // 2.1 Screen-space vertices of the tile batches (this view's slot)
+    const auto transformStart = std::chrono::steady_clock::now();
+    view.sortMs = std::chrono::duration<double, std::milli>(transformStart - sortStart).count();
+    for (const RenderItem& item : queue.GetStaticItems()) {
+        if (item.type == RenderItem::TileBatch) {
+            Olympe::Rendering::TileGeometry::UpdateScreenVertices(*item.tiles.block, view.tileView, view.tileCamera);
+        }
+    }
+    view.transformMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - transformStart).count();
+}
+
+void RenderMultiLayerForCamera(RenderView& view)
+{
+    using Olympe::Rendering::RenderItem;
+    
+    const CameraTransform& cam = view.cam;
+    const Olympe::Rendering::RenderQueue& queue = *view.queue;
+    Olympe::Tiled::ParallaxLayerManager& parallaxMgr = Olympe::Tiled::ParallaxLayerManager::Get();
+    const auto& parallaxLayers = parallaxMgr.GetLayers();
+    Olympe::Rendering::TileGeometry& tileGeometry = World::Get().GetTileGeometry();
     
     // ================================================================
     // PHASE 3: BATCH RENDER
     // ================================================================
-    for (const auto& item : renderBatch) {
+    Olympe::Rendering::TileBlockCache& tileCache = World::Get().GetTileBlockCache();
+    
+    // Consecutive entity sprites on the same texture (atlas page) share one draw call:
+    // the batch is flushed before anything else is drawn
+    Olympe::Rendering::SpriteBatcher& spriteBatcher = World::Get().GetSystem<RenderingSystem>()->GetSpriteBatcher();
+    const size_t spriteDrawCalls = spriteBatcher.GetDrawCallCount();
+    view.drawCalls = 0;
+    
+    queue.Visit([&](const RenderItem& item) {
+        if (item.type != RenderItem::Entity) {
+            spriteBatcher.Flush(GameEngine::renderer);
+        }
         switch (item.type) {
             case RenderItem::ParallaxLayer:
                 parallaxMgr.RenderLayer(parallaxLayers[item.parallax.layerIndex], cam);
+                ++view.drawCalls;
+                break;
+                
+            case RenderItem::TileBatch:
+                tileGeometry.DrawBatch(GameEngine::renderer, *item.tiles.block, *item.tiles.batch, view.tileView, view.tileCamera);
+                ++view.drawCalls;
                 break;
                 
-            case RenderItem::IndividualTile:
-                RenderTileImmediate(
-                    item.tile.texture, item.tile.srcRect,
-                    item.tile.worldX, item.tile.worldY, item.tile.gid,
-                    item.tile.tileoffsetX, item.tile.tileoffsetY,
-                    cam, mapOrientation, tileWidth, tileHeight
-                );
+            case RenderItem::TileBlock:
+                if (tileCache.Draw(GameEngine::renderer, tileGeometry, *item.tiles.block, view.tileView, view.tileCamera)) {
+                    ++view.drawCalls;
+                } else {
+                    tileGeometry.DrawBlock(GameEngine::renderer, *item.tiles.block, view.tileView, view.tileCamera);
+                    view.drawCalls += item.tiles.block->batches.size();
+                }
                 break;
                 
             case RenderItem::Entity:
-                RenderSingleEntity(cam, item.entity.entityId);
+                if (item.entity.sprite) {
+                    BatchSceneSprite(cam, *item.entity.sprite, spriteBatcher);
+                }
                 break;
         }
+    });
+    spriteBatcher.Flush(GameEngine::renderer);
+    view.drawCalls += spriteBatcher.GetDrawCallCount() - spriteDrawCalls;
+    
+    // Entity debug info on top of the sprites (drawn per entity, would split the batches)
+    for (const RenderItem& item : queue.GetDynamicItems()) {
+        RenderEntityDebugInfo(cam, item.entity.entityId);
     }
     
     // ================================================================
@@ -1096,7 +1013,6 @@ void RenderSingleEntity(const CameraTransform& cam, EntityID entity)
 {
     try
     {
-        Identity_data& id = World::Get().GetComponent<Identity_data>(entity);
         Position_data& pos = World::Get().GetComponent<Position_data>(entity);
         VisualSprite_data& visual = World::Get().GetComponent<VisualSprite_data>(entity);
         BoundingBox_data& boxComp = World::Get().GetComponent<BoundingBox_data>(entity);
@@ -1159,10 +1075,50 @@ void RenderSingleEntity(const CameraTransform& cam, EntityID entity)
                     break;
             }/**/
         }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "RenderSingleEntity Error for Entity " << entity << ": " << e.what() << "\n";
+    }
+
+    RenderEntityDebugInfo(cam, entity);
+}
+
+// Queue a scene sprite in the sprite batcher (already frustum culled).
+// Same placement as RenderSingleEntity; the texture region was resolved by the scene extraction.
+void BatchSceneSprite(const CameraTransform& cam, const Olympe::Rendering::SceneSprite& sprite, Olympe::Rendering::SpriteBatcher& batcher)
+{
+    if (!sprite.texture)
+        return;
+    
+    Vector centerScreen = cam.WorldToScreen(Vector(sprite.worldX, sprite.worldY, 0.f));
+    Vector screenSize = cam.WorldSizeToScreenSize(
+        Vector(sprite.worldBounds.w, sprite.worldBounds.h, 0.f)
+    );
+    SDL_FRect destRect = {
+        centerScreen.x - sprite.hotSpotX * cam.zoom,
+        centerScreen.y - sprite.hotSpotY * cam.zoom,
+        screenSize.x,
+        screenSize.y
+    };
+    SDL_FPoint fpoint = { sprite.hotSpotX * cam.zoom, sprite.hotSpotY * cam.zoom };
+    
+    batcher.Add(GameEngine::renderer, sprite.texture, sprite.srcRect, destRect, cam.rotation, fpoint, sprite.color);
+}
+
+// Debug info of an entity: pivot, bounding box, name and position, collision zone
+void RenderEntityDebugInfo(const CameraTransform& cam, EntityID entity)
+{
+    try
+    {
+        Identity_data& id = World::Get().GetComponent<Identity_data>(entity);
+        Position_data& pos = World::Get().GetComponent<Position_data>(entity);
+        VisualSprite_data& visual = World::Get().GetComponent<VisualSprite_data>(entity);
+        BoundingBox_data& boxComp = World::Get().GetComponent<BoundingBox_data>(entity);
 
         SDL_SetRenderDrawColor(GameEngine::renderer, 255, 255, 0, 255); // yellow
 
-		destRect = { pos.position.x - visual.hotSpot.x, pos.position.y - visual.hotSpot.y, boxComp.boundingBox.w, boxComp.boundingBox.h };
+		SDL_FRect destRect = { pos.position.x - visual.hotSpot.x, pos.position.y - visual.hotSpot.y, boxComp.boundingBox.w, boxComp.boundingBox.h };
 
         Draw_FilledCircle((int)(destRect.x + destRect.w / 2), (int)(destRect.y + destRect.h / 2), 3); // draw pivot/centre
         Draw_Rectangle(&destRect, SDL_Color{ 0, 255, 255, 255 }); // draw bounding box
@@ -1187,7 +1143,7 @@ void RenderSingleEntity(const CameraTransform& cam, EntityID entity)
     }
     catch (const std::exception& e)
     {
-        std::cerr << "RenderSingleEntity Error for Entity " << entity << ": " << e.what() << "\n";
+        std::cerr << "RenderEntityDebugInfo Error for Entity " << entity << ": " << e.what() << "\n";
     }
 }
 
@@ -1548,29 +1504,41 @@ NavigationSystem::NavigationSystem()
 	// Require Position_data and NavigationAgent_data
 	requiredSignature.set(GetComponentTypeID_Static<Position_data>(), true);
 	requiredSignature.set(GetComponentTypeID_Static<NavigationAgent_data>(), true);
+
+	// Parallel scheduling: the navigation map is read-only during Process
+	Writes<Position_data>();
+	Writes<NavigationAgent_data>();
 }
 
 void NavigationSystem::Process()
 {
-	float deltaTime = GameEngine::fDt;
-	
-	for (EntityID entity : m_entities)
-    {
-		NavigationAgent_data& agent = World::Get().GetComponent<NavigationAgent_data>(entity);
-		
-		// Check if we need to repath
-		if (agent.needsRepath)
-		{
-			RequestPath(entity, agent.targetPosition);
-			agent.needsRepath = false;
-		}
-		
-		// Follow current path if we have one
-		if (agent.hasPath && !agent.currentPath.empty())
+	if (m_entities.empty())
+		return;
+
+	const float deltaTime = GameEngine::fDt;
+
+	// Agents are independent: chunks of the view run in parallel.
+	// Path requests only read the navigation map, so they are safe here as well.
+	auto view = World::Get().View<Position_data, NavigationAgent_data>();
+	view.ParallelForEach(
+		[this, &view, deltaTime](EntityID entity, Position_data& position, NavigationAgent_data& agent)
 		{
-			FollowPath(entity, deltaTime);
-		}
-	}
+			// Check if we need to repath
+			if (agent.needsRepath)
+			{
+				RequestPath(entity, agent.targetPosition);
+				agent.needsRepath = false;
+			}
+
+			// Follow current path if we have one
+			if (agent.hasPath && !agent.currentPath.empty())
+			{
+				const Vector previous = position.position;
+				FollowPath(agent, position, deltaTime);
+				if (!(position.position == previous))
+					view.MarkChanged<Position_data>(entity);
+			}
+		});
 }
 
 void NavigationSystem::RequestPath(EntityID entity, const Vector& targetPos)
@@ -1616,9 +1584,12 @@ void NavigationSystem::RequestPath(EntityID entity, const Vector& targetPos)
 
 void NavigationSystem::FollowPath(EntityID entity, float deltaTime)
 {
-	NavigationAgent_data& agent = World::Get().GetComponent<NavigationAgent_data>(entity);
-	Position_data& position = World::Get().GetComponent<Position_data>(entity);
-	
+	FollowPath(World::Get().GetComponent<NavigationAgent_data>(entity),
+	           World::Get().GetComponent<Position_data>(entity), deltaTime);
+}
+
+void NavigationSystem::FollowPath(NavigationAgent_data& agent, Position_data& position, float deltaTime)
+{
 	if (agent.currentWaypointIndex >= static_cast<int>(agent.currentPath.size()))
 	{
 		// Path completed
@@ -1679,12 +1650,9 @@ GridSystem::GridSystem() {}
 const GridSettings_data* GridSystem::FindSettings() const
 {
     // Singleton simple: on prend la 1�re entit� qui a GridSettings_data
-    for (const auto& kv : World::Get().m_entitySignatures)
-    {
-        EntityID e = kv.first;
-        if (World::Get().HasComponent<GridSettings_data>(e))
-            return &World::Get().GetComponent<GridSettings_data>(e);
-    }
+    auto view = World::Get().View<GridSettings_data>();
+    if (!view.empty())
+        return &view.Get<GridSettings_data>(view.Entities()[0]);
     return nullptr;
 }
 
@@ -1726,66 +1694,35 @@ void GridSystem::Render()
     const GridSettings_data* s = FindSettings();
     if (!s || !s->enabled) return;
 
-    // Get actual players from ViewportManager
-    const auto& players = ViewportManager::Get().GetPlayers();
-    
-    if (!players.empty())
-    {
-        // Multi-player case: render grid for each player's camera
-        for (short playerID : players)
-        {
-            CameraTransform cam = GetActiveCameraTransform(playerID);
-            if (!cam.isActive) continue;
-
-            SDL_Rect viewportRect = {
-                (int)cam.viewport.x,
-                (int)cam.viewport.y,
-                (int)cam.viewport.w,
-                (int)cam.viewport.h
-            };
-            SDL_SetRenderViewport(renderer, &viewportRect);
-            SDL_SetRenderClipRect(renderer, &viewportRect);
+    // Cameras of this frame, already looked up by RenderingSystem (player cameras,
+    // or the default camera playerId=-1 without players)
+    RenderingSystem* rendering = World::Get().GetSystem<RenderingSystem>();
+    if (!rendering) return;
 
-            switch (s->projection)
-            {
-            case GridProjection::Ortho:    RenderOrtho(cam, *s); break;
-            case GridProjection::Iso:      RenderIso(cam, *s); break;
-            case GridProjection::HexAxial: RenderHex(cam, *s); break;
-            default: RenderOrtho(cam, *s); break;
-            }
-
-            // Reset viewport and clip rect after each viewport
-            SDL_SetRenderClipRect(renderer, nullptr);
-            SDL_SetRenderViewport(renderer, nullptr);
-        }
-    }
-    else
+    for (const RenderView& view : rendering->GetFrameViews())
     {
-        // No-players case: render grid with default camera (playerId=-1)
-        CameraTransform cam = GetActiveCameraTransform(-1);
-        if (cam.isActive)
-        {
-            SDL_Rect viewportRect = {
-                (int)cam.viewport.x,
-                (int)cam.viewport.y,
-                (int)cam.viewport.w,
-                (int)cam.viewport.h
-            };
-            SDL_SetRenderViewport(renderer, &viewportRect);
-            SDL_SetRenderClipRect(renderer, &viewportRect);
+        const CameraTransform& cam = view.cam;
 
-            switch (s->projection)
-            {
-            case GridProjection::Ortho:    RenderOrtho(cam, *s); break;
-            case GridProjection::Iso:      RenderIso(cam, *s); break;
-            case GridProjection::HexAxial: RenderHex(cam, *s); break;
-            default: RenderOrtho(cam, *s); break;
-            }
+        SDL_Rect viewportRect = {
+            (int)cam.viewport.x,
+            (int)cam.viewport.y,
+            (int)cam.viewport.w,
+            (int)cam.viewport.h
+        };
+        SDL_SetRenderViewport(renderer, &viewportRect);
+        SDL_SetRenderClipRect(renderer, &viewportRect);
 
-            // Reset viewport and clip rect
-            SDL_SetRenderClipRect(renderer, nullptr);
-            SDL_SetRenderViewport(renderer, nullptr);
+        switch (s->projection)
+        {
+        case GridProjection::Ortho:    RenderOrtho(cam, *s); break;
+        case GridProjection::Iso:      RenderIso(cam, *s); break;
+        case GridProjection::HexAxial: RenderHex(cam, *s); break;
+        default: RenderOrtho(cam, *s); break;
         }
+
+        // Reset viewport and clip rect after each viewport
+        SDL_SetRenderClipRect(renderer, nullptr);
+        SDL_SetRenderViewport(renderer, nullptr);
     }
 
     // Final reset
@@ -2479,6 +2416,7 @@ UIRenderingSystem::UIRenderingSystem()
     requiredSignature.set(GetComponentTypeID_Static<Position_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<VisualSprite_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<BoundingBox_data>(), true);
+    requiredSignature.set(GetComponentTypeID_Static<UIElement_data>(), true);
 }
 
 void UIRenderingSystem::Render()
@@ -2541,20 +2479,15 @@ void UIRenderingSystem::Render()
 
 void UIRenderingSystem::RenderHUD(const CameraTransform& cam)
 {
-    // Render HUD entities (health bars, score, etc.)
+    static const AtomID s_menuElementAtom = InternAtom("MenuElement");
+
+    // Render HUD entities (health bars, score, etc.): membership already requires UIElement_data
     for (EntityID entity : m_entities)
     {
-        if (!World::Get().HasComponent<Identity_data>(entity))
-            continue;
-        
         Identity_data& id = World::Get().GetComponent<Identity_data>(entity);
         
-        // Only render UI elements
-        if (id.type != "UIElement")
-            continue;
-        
         // Skip menu-specific elements
-        if (id.tag == "MenuElement")
+        if (id.tagAtom == s_menuElementAtom)
             continue;
         
         Position_data& pos = World::Get().GetComponent<Position_data>(entity);
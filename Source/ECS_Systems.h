@@ -18,16 +18,24 @@ ECS Systems purpose: Define systems that operate on entities with specific compo
 #include "vector.h"
 #include <unordered_map>
 #include "system/message.h"
+#include "Rendering/RenderQueue.h"
+#include "Rendering/RenderScene.h"
+#include "Rendering/SpriteBatcher.h"
+#include "Rendering/Affine2D.h"
 
 // Forward declaration
 struct CameraTransform;
+struct RenderView;
 struct GridSettings_data;
 struct CameraInputBinding_data;
 
 // Prototype function to render entities for a given camera
 void RenderEntitiesForCamera(const CameraTransform& cam);
-void RenderMultiLayerForCamera(const CameraTransform& cam);
+void PrepareMultiLayerForCamera(RenderView& view, const Olympe::Rendering::RenderScene& scene);
+void RenderMultiLayerForCamera(RenderView& view);
 void RenderSingleEntity(const CameraTransform& cam, EntityID entity);
+void BatchSceneSprite(const CameraTransform& cam, const Olympe::Rendering::SceneSprite& sprite, Olympe::Rendering::SpriteBatcher& batcher);
+void RenderEntityDebugInfo(const CameraTransform& cam, EntityID entity);
 // Get the active camera transform for a specific player
 CameraTransform GetActiveCameraTransform(short playerID);
 
@@ -38,8 +46,18 @@ public:
     // The signature required for an Entity to be processed by this System
     ComponentSignature requiredSignature;
 
-    // The set of Entities this System processes in its Update loop
-    std::set<EntityID> m_entities;
+    // Entities owning any of these components are never processed by this System
+    ComponentSignature excludedSignature;
+
+    // The set of Entities this System processes in its Update loop (packed, O(1) insert/erase)
+    EntitySet m_entities;
+
+    // Component access declared for the parallel scheduler (see ECS_Scheduler.h).
+    // Systems that declare nothing run alone on the main thread.
+    ComponentSignature readSignature;
+    ComponentSignature writeSignature;
+    bool accessDeclared = false;
+    bool mainThreadOnly = false; // Declared access, but Process() must stay on the main thread
 
     ECS_System() : requiredSignature() {}
 
@@ -49,8 +67,28 @@ public:
 	virtual void Render() {}
     virtual void RenderDebug() {}
 
-    void AddEntity(EntityID entity) { m_entities.insert(entity); }
-    void RemoveEntity(EntityID entity) { m_entities.erase(entity); }
+    // Called by the World when an entity starts/stops matching (also for non-members)
+    virtual void AddEntity(EntityID entity) { m_entities.insert(entity); }
+    virtual void RemoveEntity(EntityID entity) { m_entities.erase(entity); }
+
+protected:
+    // Access declaration helpers, called from system constructors
+    template <typename T>
+    void Reads()
+    {
+        readSignature.set(GetComponentTypeID_Static<T>(), true);
+        accessDeclared = true;
+    }
+
+    template <typename T>
+    void Writes()
+    {
+        writeSignature.set(GetComponentTypeID_Static<T>(), true);
+        accessDeclared = true;
+    }
+
+    // For systems that touch no component at all
+    void DeclareNoComponentAccess() { accessDeclared = true; }
 };
 
 
@@ -123,13 +161,6 @@ class PhysicsSystem : public ECS_System
     PhysicsSystem();
     virtual void Process() override;
 };
-// Collision System: processes entities with BoundingBox_data and Position_data
-class CollisionSystem : public ECS_System
-{
-    public:
-    CollisionSystem();
-    virtual void Process() override;
-};
 // Trigger System: processes entities with TriggerZone_data and Position_data
 class TriggerSystem : public ECS_System
 {
@@ -149,6 +180,7 @@ public:
 	
 	// Follow current path
 	void FollowPath(EntityID entity, float deltaTime);
+	static void FollowPath(NavigationAgent_data& agent, Position_data& position, float deltaTime);
 	
 	// Check if repath needed (obstacle detected)
 	bool NeedsRepath(EntityID entity);
@@ -160,13 +192,6 @@ class MovementSystem : public ECS_System
     MovementSystem();
     virtual void Process() override;
 };
-// Rendering System: processes entities with Transform_data and VisualSprite_data
-class RenderingSystem : public ECS_System
-{
-public:
-    RenderingSystem();
-	virtual void Render() override;
-};
 // Rendering Editor System: displays editor-specific visuals (grid, gizmos, etc.)
 class RenderingEditorSystem : public ECS_System
 {
@@ -307,6 +332,8 @@ public:
 //-------------------------------------------------------------
 
 // Structure that holds camera transformation data for rendering
+// The world<->screen matrices are computed once per frame by UpdateAffine
+// (GetActiveCameraTransform does it): call it again after changing the fields.
 struct CameraTransform
 {
     Vector worldPosition;        // Camera position in world space
@@ -316,45 +343,36 @@ struct CameraTransform
     SDL_FRect viewport = {0.f, 0.f, 0.f, 0.f};          // Viewport rectangle
     bool isActive = false;               // Is this camera active
 
+    Olympe::Rendering::Affine2D worldToScreen;   // Valid when hasAffine
+    Olympe::Rendering::Affine2D screenToWorld;
+    bool hasAffine = false;
+
+    // World to viewport-local screen: relative to the camera, rotated, zoomed,
+    // shifted by the screen offset, then centered in the viewport
+    Olympe::Rendering::Affine2D BuildWorldToScreen() const
+    {
+        using Olympe::Rendering::Affine2D;
+        return Affine2D::Translate(viewport.w / 2.0f - screenOffset.x, viewport.h / 2.0f - screenOffset.y)
+            * Affine2D::RotateScale(rotation, zoom)
+            * Affine2D::Translate(-worldPosition.x, -worldPosition.y);
+    }
+
+    // Cache both matrices for the current fields
+    void UpdateAffine()
+    {
+        worldToScreen = BuildWorldToScreen();
+        screenToWorld = worldToScreen.Inverse();
+        hasAffine = true;
+    }
+
     // Transform a world position to screen coordinates
     Vector WorldToScreen(const Vector& worldPos) const
     {
         if (!isActive)
             return worldPos;
 
-        // 1. Calculate position relative to camera
-        Vector relative = worldPos;
-        relative = relative - worldPosition;
-
-        // 2. Apply rotation (convert degrees to radians)
-        if (rotation != 0.0f)
-        {
-            float rotRad = rotation * (float)(k_PI / 180.0);
-            float cosRot = std::cos(rotRad);
-            float sinRot = std::sin(rotRad);
-
-            float rotatedX = relative.x * cosRot - relative.y * sinRot;
-            float rotatedY = relative.x * sinRot + relative.y * cosRot;
-
-            relative.x = rotatedX;
-            relative.y = rotatedY;
-        }
-
-        // 3. Apply zoom
-        relative.x *= zoom;
-        relative.y *= zoom;
-
-        // 4. Apply screen offset (control offset + shake)
-        relative.x -= screenOffset.x;
-        relative.y -= screenOffset.y;
-
-        // 5. Center in viewport
-        // SDL viewport is already set; coordinates are viewport-local
-        // Add half viewport dimensions to center within viewport bounds
-        relative.x += viewport.w / 2.0f;
-        relative.y += viewport.h / 2.0f;
-
-        return relative;
+        const Olympe::Rendering::Affine2D m = hasAffine ? worldToScreen : BuildWorldToScreen();
+        return Vector(m.ApplyX(worldPos.x, worldPos.y), m.ApplyY(worldPos.x, worldPos.y), worldPos.z - worldPosition.z);
     }
 
     // Transform a world size to screen size
@@ -365,45 +383,14 @@ struct CameraTransform
     }
 
     // Transform a screen position to world coordinates (inverse of WorldToScreen)
+    // screenPos is viewport-local when SDL viewport is set
     Vector ScreenToWorld(const Vector& screenPos) const
     {
         if (!isActive)
             return screenPos;
 
-        // 1. Remove viewport offset
-        // screenPos is viewport-local when SDL viewport is set
-        // Coordinates are relative to viewport's top-left corner (0,0)
-        Vector relative;
-        relative.x = screenPos.x - viewport.w / 2.0f;
-        relative.y = screenPos.y - viewport.h / 2.0f;
-
-        // 2. Remove screen offset (shake + control)
-        relative.x += screenOffset.x;
-        relative.y += screenOffset.y;
-
-        // 3. Inverse zoom
-        relative.x /= zoom;
-        relative.y /= zoom;
-
-        // 4. Inverse rotation (if any)
-        if (rotation != 0.0f)
-        {
-            float rotRad = -rotation * (float)(k_PI / 180.0);
-            float cosRot = std::cos(rotRad);
-            float sinRot = std::sin(rotRad);
-
-            float rotatedX = relative.x * cosRot - relative.y * sinRot;
-            float rotatedY = relative.x * sinRot + relative.y * cosRot;
-
-            relative.x = rotatedX;
-            relative.y = rotatedY;
-        }
-
-        // 5. Add world position
-        relative.x += worldPosition.x;
-        relative.y += worldPosition.y;
-
-        return relative;
+        const Olympe::Rendering::Affine2D m = hasAffine ? screenToWorld : BuildWorldToScreen().Inverse();
+        return Vector(m.ApplyX(screenPos.x, screenPos.y), m.ApplyY(screenPos.x, screenPos.y), 0.f);
     }
 
     // Check if a world-space bounding box is visible in this camera
@@ -451,4 +438,90 @@ struct CameraTransform
 
         return intersects;
     }
-};
\ No newline at end of file
+};
+
+// Active camera of one viewport for the current frame, with its per-view render state.
+// Computed once per frame by RenderingSystem and reused by the other render passes.
+struct RenderView
+{
+    short playerID = -1;
+    CameraTransform cam;
+    int tileView = 0;                                   // Screen-space vertex slot of the tile blocks
+    Olympe::Rendering::TileCameraKey tileCamera;
+    Olympe::Rendering::RenderQueue* queue = nullptr;    // Owned by RenderingSystem (per player)
+    std::vector<Olympe::Rendering::TileBlock*> visibleBlocks;   // Scratch of the culling pass
+    std::vector<uint32_t> chunkScratch;
+
+    // Last frame of this view (see RenderFrameMetrics)
+    double cullMs = 0.0;
+    double sortMs = 0.0;
+    double transformMs = 0.0;
+    size_t drawCalls = 0;
+};
+
+// Timings and counts of the last RenderingSystem::Render, summed over the views.
+// View phases may run in parallel: their times add up per view, not wall-clock.
+struct RenderFrameMetrics
+{
+    size_t viewCount;
+    size_t sceneSprites;      // Extracted once for every view
+    size_t visibleSprites;    // Kept by the views' culling
+    size_t visibleBlocks;     // Tile blocks kept by the views' culling
+    size_t drawCalls;         // Parallax layers, tile batches/blocks, sprite batches
+    double extractMs;         // Tile geometry check + scene extraction and sort
+    double cullMs;            // Culling + render queue population
+    double sortMs;            // Dynamic sort
+    double transformMs;       // Tile vertices to screen space
+    double submitMs;          // Draw calls, renderer work included
+    double totalMs;           // Whole Render(), wall-clock
+
+    RenderFrameMetrics()
+    {
+        Reset();
+    }
+
+    void Reset()
+    {
+        viewCount = 0;
+        sceneSprites = 0;
+        visibleSprites = 0;
+        visibleBlocks = 0;
+        drawCalls = 0;
+        extractMs = 0.0;
+        cullMs = 0.0;
+        sortMs = 0.0;
+        transformMs = 0.0;
+        submitMs = 0.0;
+        totalMs = 0.0;
+    }
+};
+
+// Rendering System: processes entities with Transform_data and VisualSprite_data
+class RenderingSystem : public ECS_System
+{
+public:
+    RenderingSystem();
+	virtual void Render() override;
+
+    // Depth-sorted render queue of a camera, kept across frames (see RenderQueue.h)
+    Olympe::Rendering::RenderQueue& GetRenderQueue(short playerID) { return m_renderQueues[playerID]; }
+
+    // Entity sprites batched by texture / atlas page (see SpriteBatcher.h)
+    Olympe::Rendering::SpriteBatcher& GetSpriteBatcher() { return m_spriteBatcher; }
+
+    // Active cameras of the current frame in player order (empty without ECS cameras)
+    const std::vector<RenderView>& GetFrameViews() const { return m_views; }
+
+    // Timings and counts of the last frame
+    const RenderFrameMetrics& GetFrameMetrics() const { return m_metrics; }
+
+private:
+    void UpdateFrameViews();
+    void ExtractScene();
+
+    std::unordered_map<short, Olympe::Rendering::RenderQueue> m_renderQueues;
+    Olympe::Rendering::SpriteBatcher m_spriteBatcher;
+    Olympe::Rendering::RenderScene m_scene;    // Entity sprites shared by every view
+    std::vector<RenderView> m_views;
+    RenderFrameMetrics m_metrics;
+};
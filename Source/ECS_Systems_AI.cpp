@@ -169,6 +169,12 @@ AIPerceptionSystem::AIPerceptionSystem()
     requiredSignature.set(GetComponentTypeID_Static<Position_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<AIBlackboard_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<AISenses_data>(), true);
+
+    // Parallel scheduling: scans positions and players, updates its own senses/blackboard
+    Reads<Position_data>();
+    Reads<PlayerBinding_data>();
+    Writes<AISenses_data>();
+    Writes<AIBlackboard_data>();
 }
 
 void AIPerceptionSystem::Process()
@@ -242,9 +248,8 @@ void AIPerceptionSystem::Process()
             {
                 // No current target - scan for potential targets
                 // Naive scan: check all entities with PlayerBinding_data (players are potential targets)
-                for (const auto& kv : World::Get().m_entitySignatures)
+                for (EntityID potentialTarget : World::Get().GetAllEntities())
                 {
-                    EntityID potentialTarget = kv.first;
                     if (potentialTarget == entity) continue;
                     
                     // Only target entities with PlayerBinding_data (players)
@@ -308,6 +313,12 @@ AIStateTransitionSystem::AIStateTransitionSystem()
     // Requires AIBlackboard and AIState
     requiredSignature.set(GetComponentTypeID_Static<AIBlackboard_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<AIState_data>(), true);
+
+    // Parallel scheduling
+    Reads<Health_data>();
+    Writes<AIState_data>();
+    Writes<AIBlackboard_data>();
+    Writes<BehaviorTreeRuntime_data>();
 }
 
 void AIStateTransitionSystem::Process()
@@ -605,6 +616,12 @@ AIMotionSystem::AIMotionSystem()
     requiredSignature.set(GetComponentTypeID_Static<Position_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<MoveIntent_data>(), true);
     requiredSignature.set(GetComponentTypeID_Static<Movement_data>(), true);
+
+    // Parallel scheduling
+    Reads<Position_data>();
+    Reads<MoveIntent_data>();
+    Reads<PhysicsBody_data>();
+    Writes<Movement_data>();
 }
 
 void AIMotionSystem::Process()
@@ -65,6 +65,11 @@ AnimationSystem::AnimationSystem()
     //signature.set(World::Get().GetComponentID<VisualAnimation_data>());
     //signature.set(World::Get().GetComponentID<VisualSprite_data>());
     requiredSignature = signature;
+
+    // Parallel scheduling: sprite textures are loaded lazily through SDL, so stay on the main thread
+    Writes<VisualAnimation_data>();
+    Writes<VisualSprite_data>();
+    mainThreadOnly = true;
 }
 
 // ========================================================================
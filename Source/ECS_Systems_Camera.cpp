@@ -36,6 +36,14 @@ CameraSystem::CameraSystem()
 {
     // Camera system requires at minimum the Camera_data component
     requiredSignature.set(GetComponentTypeID_Static<Camera_data>(), true);
+
+    // Parallel scheduling: input managers are read-only during Process (JoystickManager is locked)
+    Reads<Position_data>();
+    Reads<CameraBounds_data>();
+    Writes<Camera_data>();
+    Writes<CameraTarget_data>();
+    Writes<CameraEffects_data>();
+    Writes<CameraInputBinding_data>();
     
     SYSTEM_LOG << "CameraSystem initialized\n";
 }
@@ -0,0 +1,63 @@
+/**
+ * @file ECS_Systems_Collision.cpp
+ * @brief Implementation of CollisionSystem
+ * @author Nicolas Chereau
+ * @date 2025
+ */
+
+#include "ECS_Systems_Collision.h"
+#include "World.h"
+#include "system/EventQueue.h"
+
+CollisionSystem::CollisionSystem()
+{
+    requiredSignature.set(GetComponentTypeID_Static<Position_data>(), true);
+    requiredSignature.set(GetComponentTypeID_Static<BoundingBox_data>(), true);
+
+    // UI elements have bounding boxes for layout, not for collisions
+    excludedSignature.set(GetComponentTypeID_Static<UIElement_data>(), true);
+
+    // Parallel scheduling: contact events go through the locked EventQueue
+    Reads<Position_data>();
+    Reads<BoundingBox_data>();
+}
+
+void CollisionSystem::RemoveEntity(EntityID entity)
+{
+    if (m_entities.erase(entity))
+        m_tracker.RemoveBox(entity);
+}
+
+void CollisionSystem::Process()
+{
+    auto view = World::Get().View<Position_data, BoundingBox_data>();
+
+    // Every box, not only Changed<T>(): some writers move entities through GetComponent()
+    SyncProxies(m_entities, view, m_tracker);
+
+    // Same boxes as the last run: same contacts, nothing to post
+    if (!m_tracker.Update(m_began, m_ended))
+        return;
+
+    PostContactEvents();
+}
+
+void CollisionSystem::PostContactEvents() const
+{
+    EventQueue& events = EventQueue::Get();
+    auto post = [&events](EventType type, const Contact& contact)
+    {
+        Message msg = Message::Create(type, EventDomain::Collision, static_cast<int>(contact.b), -1, contact.a);
+        if (type == EventType::Olympe_EventType_Object_CollideEvent)
+        {
+            msg.param1 = contact.result.normal.x * contact.result.penetration;
+            msg.param2 = contact.result.normal.y * contact.result.penetration;
+        }
+        events.Push(msg);
+    };
+
+    for (const Contact& contact : m_ended)
+        post(EventType::Olympe_EventType_Object_UncollideEvent, contact);
+    for (const Contact& contact : m_began)
+        post(EventType::Olympe_EventType_Object_CollideEvent, contact);
+}
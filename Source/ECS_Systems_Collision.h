@@ -0,0 +1,86 @@
+/**
+ * @file ECS_Systems_Collision.h
+ * @brief Collision system: broad phase over persistent proxies, AABB narrow phase, contact events
+ * @author Nicolas Chereau
+ * @date 2025
+ *
+ * Every entity with Position_data and BoundingBox_data owns a proxy in a
+ * Collision_ContactTracker. Each run pushes the world box of every entity (full refresh):
+ * positions are also written through plain GetComponent(), which stamps no change tick, so
+ * Changed<T>() views would miss them. The tracker only applies the boxes that differ from
+ * their proxy, and the broad phase only runs again when a proxy changed. It is an incremental
+ * sweep-and-prune: the sorted endpoint lists are kept between runs and only repaired around
+ * moved boxes. Contacts that began or ended since the previous run are posted as events.
+ */
+
+#pragma once
+
+#include "ECS_Systems.h"
+#include "ECS_Components.h"
+#include "CollisionSystems/Collision_ContactTracker.h"
+
+#include <vector>
+
+/**
+ * @brief Collision detection between entity bounding boxes
+ *
+ * Requires: Position_data + BoundingBox_data (UI elements excluded)
+ *
+ * World box of an entity: position + (boundingBox.x, boundingBox.y), size (w, h).
+ *
+ * Events (EventDomain::Collision, visible next frame through the EventQueue):
+ * - Olympe_EventType_Object_CollideEvent when two boxes start touching
+ * - Olympe_EventType_Object_UncollideEvent when they separate or one of them is removed
+ * with targetUid = first entity, deviceId = second entity (first < second), and for
+ * CollideEvent param1/param2 = translation that pushes the second box out of the first.
+ */
+class CollisionSystem : public ECS_System
+{
+public:
+    using Contact = Olympe::Collision_Contact;
+
+    CollisionSystem();
+    virtual void Process() override;
+
+    // Leavers lose their proxy at once, their contacts end on the next run
+    virtual void RemoveEntity(EntityID entity) override;
+
+    // Contacts of the last run, sorted by (a, b)
+    const std::vector<Contact>& GetContacts() const { return m_tracker.GetContacts(); }
+
+    // Broad phase statistics of the last run that changed a proxy
+    const Olympe::Collision_BroadPhaseMetrics& GetBroadPhaseMetrics() const { return m_tracker.GetBroadPhaseMetrics(); }
+    size_t GetProxyUpdateCount() const { return m_tracker.GetProxyUpdateCount(); }
+
+    // World box of an entity; position.z is the render layer, not a collision axis
+    static Olympe::Collision_AABB ComputeWorldAABB(const Position_data& position, const BoundingBox_data& box)
+    {
+        Olympe::Collision_AABB aabb;
+        aabb.min.x = position.position.x + box.boundingBox.x;
+        aabb.min.y = position.position.y + box.boundingBox.y;
+        aabb.max.x = aabb.min.x + box.boundingBox.w;
+        aabb.max.y = aabb.min.y + box.boundingBox.h;
+        return aabb;
+    }
+
+    // Full refresh: pushes the world box of every entity to the tracker, which keeps the ones
+    // that changed. Returns the number of boxes queued.
+    template <typename View>
+    static size_t SyncProxies(const EntitySet& entities, const View& view, Olympe::Collision_ContactTracker& tracker)
+    {
+        size_t queued = 0;
+        for (EntityID entity : entities)
+        {
+            if (tracker.SetBox(entity, ComputeWorldAABB(view.template Get<Position_data>(entity), view.template Get<BoundingBox_data>(entity))))
+                ++queued;
+        }
+        return queued;
+    }
+
+private:
+    void PostContactEvents() const;
+
+    Olympe::Collision_ContactTracker m_tracker;
+    std::vector<Contact> m_began;          // Contacts of the last run that began/ended
+    std::vector<Contact> m_ended;
+};
@@ -76,15 +76,15 @@ CameraTransform GetActiveCameraTransform(short playerID)
 
             transform.isActive = true;
             transform.screenOffset = Vector(0.f, 0.f, 0.f);
+            transform.UpdateAffine();
             return transform;
         }
     }
     
     // Fallback: iterate through entities if cache is missing or stale
-    for (const auto& pair : world.m_entitySignatures)
+    for (EntityID entity : world.GetAllEntities())
     {
-        EntityID entity = pair.first;
-        const ComponentSignature& signature = pair.second;
+        const ComponentSignature& signature = world.GetEntitySignature(entity);
         
         // Check if entity has Camera_data component
         ComponentTypeID camTypeID = GetComponentTypeID_Static<Camera_data>();
@@ -169,5 +169,7 @@ CameraTransform GetActiveCameraTransform(short playerID)
         }
     }
     
+    if (transform.isActive)
+        transform.UpdateAffine();
     return transform;
 }
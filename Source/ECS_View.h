@@ -0,0 +1,204 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+ECS View purpose: Typed query over the entities owning a given set of components.
+Views are obtained from World::View<Ts...>(). The matching entity list is cached per
+signature by the World and updated incrementally on component add/remove, so building
+a view is free and iterating it streams over a packed EntitySet.
+
+Usage:
+    auto view = World::Get().View<Position_data, Movement_data>();
+    view.Each([](EntityID e, Position_data& pos, Movement_data& move) { ... });
+
+Incremental systems iterate only the entities whose component was written through a
+mutable accessor since a given tick (see ChangeTick in ECS_Entity.h):
+    view.Changed<Position_data>(m_lastTick).Each([](EntityID e, Position_data& pos, ...) { ... });
+
+*/
+#pragma once
+
+#include "ECS_Entity.h"
+#include "ECS_Register.h"
+#include "system/JobSystem.h"
+
+#include <tuple>
+
+template <typename... Ts>
+class ComponentView
+{
+public:
+    ComponentView(const EntitySet& entities, ComponentPool<Ts>*... pools)
+        : m_entities(&entities), m_pools(pools...)
+    {
+    }
+
+    EntitySet::const_iterator begin() const { return m_entities->begin(); }
+    EntitySet::const_iterator end() const { return m_entities->end(); }
+    size_t size() const { return m_entities->size(); }
+    bool empty() const { return m_entities->empty(); }
+
+    // Packed list of matching entities
+    const EntitySet& Entities() const { return *m_entities; }
+
+    // Unchecked access: every entity of the view owns all the components in Ts
+    template <typename T>
+    T& Get(EntityID entity) const
+    {
+        return GetFrom<T>(m_pools, entity);
+    }
+
+    // Mutable access: stamps the current change tick of the entity's T
+    template <typename T>
+    T& Modify(EntityID entity) const
+    {
+        ComponentPool<T>* pool = std::get<ComponentPool<T>*>(m_pools);
+        const std::uint32_t index = pool->FindDenseIndex(entity);
+        pool->m_changeTicks[index] = GetChangeTick();
+        return pool->m_data[index];
+    }
+
+    // Stamps the entity's T after an in-place write (safe from ParallelForEach: one slot per entity)
+    template <typename T>
+    void MarkChanged(EntityID entity) const
+    {
+        ComponentPool<T>* pool = std::get<ComponentPool<T>*>(m_pools);
+        pool->m_changeTicks[pool->FindDenseIndex(entity)] = GetChangeTick();
+    }
+
+    // Subset of the view whose T was written at or after a tick
+    template <typename T>
+    class ChangedRange
+    {
+    public:
+        class const_iterator
+        {
+        public:
+            const_iterator(const ChangedRange* range, EntitySet::const_iterator it)
+                : m_range(range), m_it(it)
+            {
+                SkipUnchanged();
+            }
+
+            EntityID operator*() const { return *m_it; }
+            const_iterator& operator++() { ++m_it; SkipUnchanged(); return *this; }
+            bool operator==(const const_iterator& other) const { return m_it == other.m_it; }
+            bool operator!=(const const_iterator& other) const { return m_it != other.m_it; }
+
+        private:
+            void SkipUnchanged()
+            {
+                while (m_it != m_range->m_entities->end() && !m_range->IsChanged(*m_it))
+                    ++m_it;
+            }
+
+            const ChangedRange* m_range;
+            EntitySet::const_iterator m_it;
+        };
+
+        // Holds copies of the view's pointers, so it outlives a temporary view
+        ChangedRange(const EntitySet* entities, const std::tuple<ComponentPool<Ts>*...>& pools, ChangeTick sinceTick)
+            : m_entities(entities), m_pools(pools), m_sinceTick(sinceTick)
+        {
+        }
+
+        const_iterator begin() const { return const_iterator(this, m_entities->begin()); }
+        const_iterator end() const { return const_iterator(this, m_entities->end()); }
+
+        bool IsChanged(EntityID entity) const
+        {
+            const ComponentPool<T>* pool = std::get<ComponentPool<T>*>(m_pools);
+            return pool->m_changeTicks[pool->FindDenseIndex(entity)] >= m_sinceTick;
+        }
+
+        // Calls fn(EntityID, Ts&...) for every changed entity
+        template <typename Fn>
+        void Each(Fn&& fn) const
+        {
+            for (EntityID entity : *m_entities)
+            {
+                if (IsChanged(entity))
+                    fn(entity, GetFrom<Ts>(m_pools, entity)...);
+            }
+        }
+
+    private:
+        const EntitySet* m_entities;
+        std::tuple<ComponentPool<Ts>*...> m_pools;
+        ChangeTick m_sinceTick;
+    };
+
+    // Entities whose T was written at or after 'sinceTick'. A system that stores
+    // GetChangeTick() when it runs and passes it back next time sees every write made
+    // since (plus those made earlier in the same frame: the test is conservative).
+    // The default covers the previous and the current frame.
+    template <typename T>
+    ChangedRange<T> Changed(ChangeTick sinceTick) const
+    {
+        return ChangedRange<T>(m_entities, m_pools, sinceTick);
+    }
+
+    template <typename T>
+    ChangedRange<T> Changed() const
+    {
+        const ChangeTick now = GetChangeTick();
+        return ChangedRange<T>(m_entities, m_pools, now > 1 ? now - 1 : 0);
+    }
+
+    // Calls fn(EntityID, Ts&...) for every matching entity
+    template <typename Fn>
+    void Each(Fn&& fn) const
+    {
+        for (EntityID entity : *m_entities)
+        {
+            fn(entity, Get<Ts>(entity)...);
+        }
+    }
+
+    // Entities per chunk are rounded to whole cache lines of the packed entity list,
+    // so two jobs never share a line of it
+    static constexpr size_t ENTITIES_PER_CACHE_LINE = 64 / sizeof(EntityID);
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 256;
+
+    // Same as Each(), but chunks of the view run in parallel on the JobSystem.
+    // fn may write only the components it receives (or thread-safe state) and must not
+    // add/remove components. Entities are created/destroyed through World::GetCommandBuffer()
+    // (recording is locked). The first exception thrown by fn is rethrown once all chunks ran.
+    template <typename Fn>
+    void ParallelForEach(Fn&& fn, size_t chunkSize = DEFAULT_CHUNK_SIZE) const
+    {
+        const EntitySet& entities = *m_entities;
+        ParallelForChunks([this, &entities, &fn](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const EntityID entity = entities[i];
+                    fn(entity, Get<Ts>(entity)...);
+                }
+            }, chunkSize);
+    }
+
+    // Calls fn(begin, end) in parallel over position ranges of the packed entity list
+    // (for batched kernels working on SoA lanes, see ECS_SoA.h)
+    template <typename Fn>
+    void ParallelForChunks(Fn&& fn, size_t chunkSize = DEFAULT_CHUNK_SIZE) const
+    {
+        const size_t lines = (chunkSize + ENTITIES_PER_CACHE_LINE - 1) / ENTITIES_PER_CACHE_LINE;
+        chunkSize = (lines > 0 ? lines : 1) * ENTITIES_PER_CACHE_LINE;
+        JobSystem::Get().ParallelFor(m_entities->size(), chunkSize, fn);
+    }
+
+private:
+    template <typename T>
+    static T& GetFrom(const std::tuple<ComponentPool<Ts>*...>& pools, EntityID entity)
+    {
+        ComponentPool<T>* pool = std::get<ComponentPool<T>*>(pools);
+        return pool->m_data[pool->FindDenseIndex(entity)];
+    }
+
+    const EntitySet* m_entities;
+    std::tuple<ComponentPool<Ts>*...> m_pools;
+};
@@ -21,6 +21,7 @@ Purpose:
 #include "PanelManager.h"
 #include "World.h"
 #include "system/CameraEventHandler.h"
+#include "system/JobSystem.h"
 #include "AI/BehaviorTree.h"
 #include "Animation/AnimationManager.h"
 
@@ -49,6 +50,9 @@ void GameEngine::Initialize()
 	//PanelManager::Get().CreateInputsInspectorWindow();
 	// By default keep them hidden; can be shown by the UI later
 	
+	// Start the worker threads used by the ECS scheduler
+	JobSystem::Get().Initialize();
+
 	// Initialize camera event handler
 	CameraEventHandler::Get().Initialize();
 	
@@ -25,6 +25,7 @@ Notes:
 #include "InputsManager.h"
 #include "GameState.h"
 #include "system/ViewportManager.h"
+#include "system/JobSystem.h"
 #include "system/GameMenu.h"
 #include "DataManager.h"
 #include "system/system_utils.h"
@@ -286,6 +287,12 @@ SDL_AppResult SDL_AppEvent(void* appstate, SDL_Event* event)
             }
         }
         break;
+        case SDL_EVENT_RENDER_TARGETS_RESET:
+            // Render-target textures lost their content: copy the sprites into the
+            // atlas again and let cached tile blocks be rendered again
+            DataManager::Get().RefreshSpriteAtlas();
+            World::Get().GetTileBlockCache().Clear();
+            break;
         case SDL_EVENT_QUIT:
             {
                 // Clear input state before exiting
@@ -497,6 +504,9 @@ void SDL_AppQuit(void* appstate, SDL_AppResult result)
 
     //Olympe::BlueprintEditor::Get().Shutdown();
 
+    // Stop the ECS worker threads
+    JobSystem::Get().Shutdown();
+
     // Shutdown datamanager to ensure resources freed
     DataManager::Get().Shutdown();
 
@@ -602,6 +602,9 @@ bool PrefabFactory::InstantiateIdentity(EntityID entity, const ComponentDefiniti
         // Map string to EntityType enum using helper function
         identity.entityType = StringToEntityType(identity.type);
     }
+
+    // Keep the interned atoms and the UIElement tag in sync with the new strings
+    World::Get().RefreshIdentity(entity);
     
     // DO NOT call AddComponent() - component is already modified by reference
     return true;
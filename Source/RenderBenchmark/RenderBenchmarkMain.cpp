@@ -0,0 +1,448 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+RenderBenchmark: headless benchmark of the tile + entity rendering pipeline
+(RenderingSystem::Render -> RenderMultiLayerForCamera). There is no window and no GPU:
+frames are drawn by SDL's software renderer into an offscreen surface, so the benchmark
+runs on CI machines.
+
+The map is loaded through World::LoadLevelFromTiled (TiledLevelLoader), N prefab entities
+are spawned over it and move a little every frame, then scripted camera paths (pan, zoom,
+rotate) are played with 1 to 4 split-screen viewports. Each run reports the average
+per-frame timings of the pipeline phases (see RenderFrameMetrics), the draw calls and
+the pixel counts.
+
+Build: console target with the engine sources, without OlympeEngine.cpp (SDL_main
+callbacks). Run it from the repository root (Gamedata paths are relative).
+
+Usage:
+    RenderBenchmark [--map <file.tmj>] [--prefab <name>] [--entities <n>] [--frames <n>]
+                    [--views <1-4>] [--path pan|zoom|rotate] [--size <w>x<h>] [--budget-ms <ms>]
+    Without --views / --path, every combination is run.
+    Exit code: 0 = ok, 1 = setup failure, 2 = a run exceeded --budget-ms (average frame time).
+*/
+
+#include "../World.h"
+#include "../GameEngine.h"
+#include "../DataManager.h"
+#include "../ECS_Systems.h"
+#include "../ECS_Components.h"
+#include "../prefabfactory.h"
+#include "../system/ViewportManager.h"
+#include "../system/JobSystem.h"
+
+#include <SDL3/SDL.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const float k_TwoPi = 6.28318530718f;
+
+    enum class CameraPath
+    {
+        Pan,
+        Zoom,
+        Rotate
+    };
+
+    const CameraPath k_AllPaths[] = { CameraPath::Pan, CameraPath::Zoom, CameraPath::Rotate };
+
+    const char* GetPathName(CameraPath path)
+    {
+        switch (path)
+        {
+        case CameraPath::Pan:    return "pan";
+        case CameraPath::Zoom:   return "zoom";
+        case CameraPath::Rotate: return "rotate";
+        }
+        return "?";
+    }
+
+    struct Options
+    {
+        std::string mapPath = "Gamedata/Levels/iso-test.tmj";
+        std::string prefab = "guard";
+        int entities = 1000;
+        int frames = 300;
+        int views = 0;              // 0 = every count from 1 to 4
+        int path = -1;              // Index in k_AllPaths, -1 = every path
+        int width = 1280;
+        int height = 720;
+        double budgetMs = 0.0;      // 0 = no budget
+    };
+
+    // Averages of one run (views x camera path)
+    struct RunResult
+    {
+        RenderFrameMetrics sum;
+        double coveredPixels = 0.0;
+        int frames = 0;
+    };
+
+    // Entity moving in a small circle around its spawn point (keeps the depth sort busy)
+    struct MovingEntity
+    {
+        EntityID entity;
+        float baseX;
+        float baseY;
+        float phase;
+    };
+
+    void PrintUsage()
+    {
+        std::printf("Usage: RenderBenchmark [--map <file.tmj>] [--prefab <name>] [--entities <n>] [--frames <n>]\n"
+                    "                       [--views <1-4>] [--path pan|zoom|rotate] [--size <w>x<h>] [--budget-ms <ms>]\n");
+    }
+
+    bool ParseOptions(int argc, char* argv[], Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+            if (!value)
+                return false;
+
+            if (arg == "--map") options.mapPath = value;
+            else if (arg == "--prefab") options.prefab = value;
+            else if (arg == "--entities") options.entities = std::atoi(value);
+            else if (arg == "--frames") options.frames = std::atoi(value);
+            else if (arg == "--views") options.views = std::atoi(value);
+            else if (arg == "--budget-ms") options.budgetMs = std::atof(value);
+            else if (arg == "--size")
+            {
+                if (std::sscanf(value, "%dx%d", &options.width, &options.height) != 2)
+                    return false;
+            }
+            else if (arg == "--path")
+            {
+                options.path = -1;
+                for (int p = 0; p < 3; ++p)
+                {
+                    if (std::strcmp(value, GetPathName(k_AllPaths[p])) == 0)
+                        options.path = p;
+                }
+                if (options.path < 0)
+                    return false;
+            }
+            else
+            {
+                return false;
+            }
+            ++i;
+        }
+        return options.entities >= 0 && options.frames > 0 && options.views >= 0 && options.views <= 4 &&
+               options.width > 0 && options.height > 0;
+    }
+
+    // One player (viewport + camera) per view, laid out as VideoGame does
+    void SetupViews(int count)
+    {
+        ViewportManager& viewports = ViewportManager::Get();
+        CameraSystem* cameras = World::Get().GetSystem<CameraSystem>();
+
+        const std::vector<short> previous = viewports.GetPlayers();
+        for (short playerID : previous)
+        {
+            viewports.RemovePlayer(playerID);
+            if (cameras) cameras->RemoveCameraForPlayer(playerID);
+        }
+
+        static const ViewportLayout layouts[] = {
+            ViewportLayout::ViewportLayout_Grid1x1,
+            ViewportLayout::ViewportLayout_Grid2x1,
+            ViewportLayout::ViewportLayout_Grid3x1,
+            ViewportLayout::ViewportLayout_Grid2x2
+        };
+        for (short playerID = 0; playerID < count; ++playerID)
+        {
+            viewports.AddPlayer(playerID, layouts[count - 1]);
+            if (cameras) cameras->CreateCameraForPlayer(playerID);
+        }
+    }
+
+    // Camera of one view at time t (0..1) of a path; views look at different places
+    void ApplyCameraPath(CameraPath path, float t, int viewIndex, const SDL_FRect& area, Camera_data& cam)
+    {
+        const float centerX = area.x + area.w * 0.5f;
+        const float centerY = area.y + area.h * 0.5f;
+        const float viewPhase = viewIndex * 0.25f;
+
+        cam.baseOffset = Vector(0.f, 0.f, 0.f);
+        cam.controlOffset = Vector(0.f, 0.f, 0.f);
+        cam.position = Vector(centerX, centerY, 0.f);
+        cam.zoom = 1.0f;
+        cam.rotation = 0.0f;
+
+        switch (path)
+        {
+        case CameraPath::Pan:
+        {
+            const float angle = k_TwoPi * (t + viewPhase);
+            cam.position = Vector(centerX + std::cos(angle) * area.w * 0.35f,
+                                  centerY + std::sin(angle) * area.h * 0.35f, 0.f);
+            break;
+        }
+        case CameraPath::Zoom:
+            // 0.5 -> 2.0 -> 0.5
+            cam.position = Vector(centerX + (viewIndex - 1.5f) * area.w * 0.1f, centerY, 0.f);
+            cam.zoom = 0.5f + 1.5f * (0.5f - 0.5f * std::cos(k_TwoPi * (t + viewPhase)));
+            break;
+        case CameraPath::Rotate:
+            cam.rotation = std::fmod(360.0f * (t + viewPhase), 360.0f);
+            break;
+        }
+
+        cam.targetZoom = cam.zoom;
+        cam.targetRotation = cam.rotation;
+    }
+
+    bool SpawnEntities(const Options& options, const SDL_FRect& area, std::vector<MovingEntity>& outEntities)
+    {
+        World& world = World::Get();
+        uint32_t seed = 12345u;
+        auto random01 = [&seed]()
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return static_cast<float>(seed >> 8) / 16777216.0f;
+        };
+
+        for (int i = 0; i < options.entities; ++i)
+        {
+            const EntityID entity = PrefabFactory::Get().CreateEntityFromPrefabName(options.prefab);
+            if (entity == INVALID_ENTITY_ID)
+            {
+                std::fprintf(stderr, "[RenderBenchmark] Cannot create prefab '%s'\n", options.prefab.c_str());
+                return false;
+            }
+            // The render path needs a position and a bounding box (sprite size by default)
+            if (!world.HasComponent<VisualSprite_data>(entity))
+                continue;
+            if (!world.HasComponent<Position_data>(entity))
+                world.AddComponent<Position_data>(entity);
+            if (!world.HasComponent<BoundingBox_data>(entity))
+            {
+                BoundingBox_data& bbox = world.AddComponent<BoundingBox_data>(entity);
+                const VisualSprite_data& visual = world.GetComponent<VisualSprite_data>(entity);
+                if (visual.sprite)
+                {
+                    bbox.boundingBox.w = static_cast<float>(visual.sprite->w);
+                    bbox.boundingBox.h = static_cast<float>(visual.sprite->h);
+                }
+            }
+
+            MovingEntity moving;
+            moving.entity = entity;
+            moving.baseX = area.x + random01() * area.w;
+            moving.baseY = area.y + random01() * area.h;
+            moving.phase = random01() * k_TwoPi;
+            outEntities.push_back(moving);
+        }
+        return true;
+    }
+
+    void MoveEntities(const std::vector<MovingEntity>& entities, float t)
+    {
+        World& world = World::Get();
+        for (const MovingEntity& moving : entities)
+        {
+            Position_data& pos = world.GetComponent<Position_data>(moving.entity);
+            const float angle = moving.phase + k_TwoPi * 4.0f * t;
+            pos.position.x = moving.baseX + std::cos(angle) * 24.0f;
+            pos.position.y = moving.baseY + std::sin(angle) * 24.0f;
+        }
+    }
+
+    // Pixels of the target that are not the clear color
+    uint64_t CountCoveredPixels(SDL_Renderer* renderer, SDL_Surface* surface, Uint32 clearPixel)
+    {
+        SDL_FlushRenderer(renderer);
+        if (!SDL_LockSurface(surface))
+            return 0;
+
+        uint64_t covered = 0;
+        for (int y = 0; y < surface->h; ++y)
+        {
+            const Uint32* row = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(surface->pixels) + y * surface->pitch);
+            for (int x = 0; x < surface->w; ++x)
+            {
+                if (row[x] != clearPixel)
+                    ++covered;
+            }
+        }
+        SDL_UnlockSurface(surface);
+        return covered;
+    }
+
+    void Accumulate(RenderFrameMetrics& sum, const RenderFrameMetrics& frame)
+    {
+        sum.viewCount = frame.viewCount;
+        sum.sceneSprites += frame.sceneSprites;
+        sum.visibleSprites += frame.visibleSprites;
+        sum.visibleBlocks += frame.visibleBlocks;
+        sum.drawCalls += frame.drawCalls;
+        sum.extractMs += frame.extractMs;
+        sum.cullMs += frame.cullMs;
+        sum.sortMs += frame.sortMs;
+        sum.transformMs += frame.transformMs;
+        sum.submitMs += frame.submitMs;
+        sum.totalMs += frame.totalMs;
+    }
+
+    RunResult RunPath(SDL_Renderer* renderer, SDL_Surface* surface, Uint32 clearPixel, CameraPath path, int viewCount,
+                      int frames, const SDL_FRect& area, const std::vector<MovingEntity>& entities)
+    {
+        World& world = World::Get();
+        RenderingSystem* rendering = world.GetSystem<RenderingSystem>();
+        CameraSystem* cameras = world.GetSystem<CameraSystem>();
+
+        SetupViews(viewCount);
+
+        RunResult result;
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            const float t = static_cast<float>(frame) / static_cast<float>(frames);
+            for (int view = 0; view < viewCount; ++view)
+            {
+                const EntityID camera = cameras->GetCameraEntityForPlayer(static_cast<short>(view));
+                if (camera != INVALID_ENTITY_ID)
+                    ApplyCameraPath(path, t, view, area, world.GetComponent<Camera_data>(camera));
+            }
+            MoveEntities(entities, t);
+
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+            SDL_RenderClear(renderer);
+            rendering->Render();
+
+            Accumulate(result.sum, rendering->GetFrameMetrics());
+            result.coveredPixels += static_cast<double>(CountCoveredPixels(renderer, surface, clearPixel));
+            ++result.frames;
+        }
+        return result;
+    }
+
+    void PrintResult(CameraPath path, int viewCount, const RunResult& result, double totalPixels)
+    {
+        const double n = result.frames > 0 ? static_cast<double>(result.frames) : 1.0;
+        const RenderFrameMetrics& m = result.sum;
+        std::printf("%5d  %-6s %7d %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f %8.1f %9.1f %8.1f %8.1f\n",
+                    viewCount, GetPathName(path), result.frames,
+                    m.totalMs / n, m.extractMs / n, m.cullMs / n, m.sortMs / n, m.transformMs / n, m.submitMs / n,
+                    m.drawCalls / n, m.visibleSprites / n, m.visibleBlocks / n,
+                    100.0 * result.coveredPixels / (n * totalPixels));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    // No display needed: the software renderer draws into a plain surface
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    if (!SDL_Init(SDL_INIT_VIDEO))
+    {
+        std::fprintf(stderr, "[RenderBenchmark] Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Surface* surface = SDL_CreateSurface(options.width, options.height, SDL_PIXELFORMAT_XRGB8888);
+    SDL_Renderer* renderer = surface ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (!renderer)
+    {
+        std::fprintf(stderr, "[RenderBenchmark] Couldn't create the software renderer: %s\n", SDL_GetError());
+        if (surface) SDL_DestroySurface(surface);
+        SDL_Quit();
+        return 1;
+    }
+    const Uint32 clearPixel = SDL_MapSurfaceRGBA(surface, 0, 0, 0, 255);
+
+    // Engine subsystems used by the render path (no input, audio or UI)
+    GameEngine::screenWidth = options.width;
+    GameEngine::screenHeight = options.height;
+    GameEngine::renderer = renderer;
+    DataManager::Get().Initialize();
+    JobSystem::Get().Initialize();
+    ViewportManager::Get().Initialize(options.width, options.height);
+
+    int exitCode = 0;
+    World& world = World::Get();
+    if (!world.LoadLevelFromTiled(options.mapPath))
+    {
+        std::fprintf(stderr, "[RenderBenchmark] Cannot load map '%s'\n", options.mapPath.c_str());
+        exitCode = 1;
+    }
+    else
+    {
+        while (world.IsDeferredLevelLoadingActive())
+            world.UpdateDeferredLevelLoading();
+
+        // Warm-up frame: bakes the tile geometry, which gives the map area
+        SetupViews(1);
+        world.GetSystem<RenderingSystem>()->Render();
+        SDL_FRect area = world.GetTileGeometry().GetWorldBounds();
+        if (area.w <= 0.0f || area.h <= 0.0f)
+            area = SDL_FRect{ 0.0f, 0.0f, 2048.0f, 2048.0f };
+
+        std::vector<MovingEntity> entities;
+        if (!SpawnEntities(options, area, entities))
+        {
+            exitCode = 1;
+        }
+        else
+        {
+            world.FlushCommandBuffer();
+
+            std::printf("\n[RenderBenchmark] map=%s prefab=%s entities=%d frames=%d size=%dx%d workers=%u\n",
+                        options.mapPath.c_str(), options.prefab.c_str(), static_cast<int>(entities.size()),
+                        options.frames, options.width, options.height, JobSystem::Get().GetWorkerCount());
+            std::printf("(per frame; view phases are summed over the views)\n");
+            std::printf("views  path    frames  total ms extract    cull     sort   xform   submit    draws   sprites   blocks covered%%\n");
+
+            const double totalPixels = static_cast<double>(options.width) * options.height;
+            const int firstViews = options.views > 0 ? options.views : 1;
+            const int lastViews = options.views > 0 ? options.views : 4;
+            for (int viewCount = firstViews; viewCount <= lastViews; ++viewCount)
+            {
+                for (int p = 0; p < 3; ++p)
+                {
+                    if (options.path >= 0 && options.path != p)
+                        continue;
+
+                    const RunResult result = RunPath(renderer, surface, clearPixel, k_AllPaths[p], viewCount,
+                                                     options.frames, area, entities);
+                    PrintResult(k_AllPaths[p], viewCount, result, totalPixels);
+
+                    const double averageMs = result.sum.totalMs / result.frames;
+                    if (options.budgetMs > 0.0 && averageMs > options.budgetMs)
+                    {
+                        std::printf("[RenderBenchmark] Over budget: %.3f ms > %.3f ms\n", averageMs, options.budgetMs);
+                        exitCode = 2;
+                    }
+                }
+            }
+        }
+    }
+
+    world.UnloadCurrentLevel();
+    world.GetTileBlockCache().Clear();
+    DataManager::Get().UnloadAll();
+    JobSystem::Get().Shutdown();
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+    SDL_Quit();
+    return exitCode;
+}
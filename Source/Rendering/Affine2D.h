@@ -0,0 +1,77 @@
+/*
+ * Olympe Engine V2 - 2025
+ * 2D Affine Transform
+ *
+ * 2x3 matrix mapping (x, y) to (m00*x + m01*y + m02, m10*x + m11*y + m12).
+ * Camera transforms (translate, rotate, zoom, recenter) are composed into one
+ * matrix once per frame, so transforming a point is 4 multiply-adds with no
+ * trigonometry and no branch.
+ */
+
+#pragma once
+
+#include <cmath>
+
+namespace Olympe {
+namespace Rendering {
+
+    struct Affine2D
+    {
+        float m00 = 1.0f, m01 = 0.0f, m02 = 0.0f;
+        float m10 = 0.0f, m11 = 1.0f, m12 = 0.0f;
+
+        static Affine2D Translate(float x, float y)
+        {
+            Affine2D m;
+            m.m02 = x;
+            m.m12 = y;
+            return m;
+        }
+
+        // Clockwise rotation in degrees (SDL screen space, y down), then uniform scale
+        static Affine2D RotateScale(float degrees, float scale)
+        {
+            float cosRot = 1.0f, sinRot = 0.0f;
+            if (degrees != 0.0f)
+            {
+                const float rotRad = degrees * (3.14159265358979323846f / 180.0f);
+                cosRot = std::cos(rotRad);
+                sinRot = std::sin(rotRad);
+            }
+            Affine2D m;
+            m.m00 = cosRot * scale; m.m01 = -sinRot * scale;
+            m.m10 = sinRot * scale; m.m11 = cosRot * scale;
+            return m;
+        }
+
+        // 'rhs' first, then this transform
+        Affine2D operator*(const Affine2D& rhs) const
+        {
+            Affine2D m;
+            m.m00 = m00 * rhs.m00 + m01 * rhs.m10;
+            m.m01 = m00 * rhs.m01 + m01 * rhs.m11;
+            m.m02 = m00 * rhs.m02 + m01 * rhs.m12 + m02;
+            m.m10 = m10 * rhs.m00 + m11 * rhs.m10;
+            m.m11 = m10 * rhs.m01 + m11 * rhs.m11;
+            m.m12 = m10 * rhs.m02 + m11 * rhs.m12 + m12;
+            return m;
+        }
+
+        // Inverse transform (a zero scale gives non-finite values, as dividing by the zoom did)
+        Affine2D Inverse() const
+        {
+            const float invDet = 1.0f / (m00 * m11 - m01 * m10);
+            Affine2D m;
+            m.m00 = m11 * invDet;  m.m01 = -m01 * invDet;
+            m.m10 = -m10 * invDet; m.m11 = m00 * invDet;
+            m.m02 = -(m.m00 * m02 + m.m01 * m12);
+            m.m12 = -(m.m10 * m02 + m.m11 * m12);
+            return m;
+        }
+
+        float ApplyX(float x, float y) const { return m00 * x + m01 * y + m02; }
+        float ApplyY(float x, float y) const { return m10 * x + m11 * y + m12; }
+    };
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,113 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Atlas Packer Implementation
+ */
+
+#include "AtlasPacker.h"
+#include <algorithm>
+#include <climits>
+
+namespace Olympe {
+namespace Rendering {
+
+    void AtlasPacker::Reset(int width, int height)
+    {
+        m_width = width;
+        m_height = height;
+        m_usedArea = 0;
+        m_skyline.clear();
+        SkylineNode ground = { 0, 0, width };
+        m_skyline.push_back(ground);
+    }
+
+    float AtlasPacker::GetOccupancy() const
+    {
+        const int64_t area = static_cast<int64_t>(m_width) * m_height;
+        return area > 0 ? static_cast<float>(static_cast<double>(m_usedArea) / static_cast<double>(area)) : 0.0f;
+    }
+
+    int AtlasPacker::Fit(std::size_t index, int w, int h) const
+    {
+        const int x = m_skyline[index].x;
+        if (x + w > m_width)
+            return -1;
+
+        // Highest skyline segment under the rectangle's span
+        int y = m_skyline[index].y;
+        int widthLeft = w;
+        for (size_t i = index; widthLeft > 0; ++i)
+        {
+            y = std::max(y, m_skyline[i].y);
+            if (y + h > m_height)
+                return -1;
+            widthLeft -= m_skyline[i].width;
+        }
+        return y;
+    }
+
+    bool AtlasPacker::Insert(int w, int h, AtlasRect& outRect)
+    {
+        if (w <= 0 || h <= 0 || m_skyline.empty())
+            return false;
+
+        size_t bestIndex = m_skyline.size();
+        int bestTop = INT_MAX;
+        int bestWidth = INT_MAX;
+        int bestY = 0;
+        for (size_t i = 0; i < m_skyline.size(); ++i)
+        {
+            const int y = Fit(i, w, h);
+            if (y < 0)
+                continue;
+            if (y + h < bestTop || (y + h == bestTop && m_skyline[i].width < bestWidth))
+            {
+                bestIndex = i;
+                bestTop = y + h;
+                bestWidth = m_skyline[i].width;
+                bestY = y;
+            }
+        }
+        if (bestIndex == m_skyline.size())
+            return false;
+
+        outRect.x = m_skyline[bestIndex].x;
+        outRect.y = bestY;
+        outRect.w = w;
+        outRect.h = h;
+        m_usedArea += static_cast<int64_t>(w) * h;
+
+        // New segment on top of the rectangle, then trim the segments it covers
+        SkylineNode top = { outRect.x, bestY + h, w };
+        m_skyline.insert(m_skyline.begin() + bestIndex, top);
+        for (size_t i = bestIndex + 1; i < m_skyline.size(); )
+        {
+            const int coveredEnd = m_skyline[i - 1].x + m_skyline[i - 1].width;
+            if (m_skyline[i].x >= coveredEnd)
+                break;
+            const int shrink = coveredEnd - m_skyline[i].x;
+            if (m_skyline[i].width <= shrink)
+            {
+                m_skyline.erase(m_skyline.begin() + i);
+                continue;
+            }
+            m_skyline[i].x += shrink;
+            m_skyline[i].width -= shrink;
+            break;
+        }
+
+        // Merge neighbours at the same height
+        for (size_t i = 1; i < m_skyline.size(); )
+        {
+            if (m_skyline[i - 1].y == m_skyline[i].y)
+            {
+                m_skyline[i - 1].width += m_skyline[i].width;
+                m_skyline.erase(m_skyline.begin() + i);
+                continue;
+            }
+            ++i;
+        }
+        return true;
+    }
+
+} // namespace Rendering
+} // namespace Olympe
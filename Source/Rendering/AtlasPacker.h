@@ -0,0 +1,63 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Atlas Packer
+ *
+ * Skyline bottom-left rectangle packer for one atlas page.
+ * The skyline is the list of top edges of the packed area; each rectangle is placed
+ * where its top ends lowest (then on the narrowest segment), which packs sprites added
+ * one at a time (load order) almost as tightly as an offline sort by height.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Olympe {
+namespace Rendering {
+
+    struct AtlasRect
+    {
+        int x = 0;
+        int y = 0;
+        int w = 0;
+        int h = 0;
+    };
+
+    class AtlasPacker
+    {
+    public:
+        AtlasPacker() = default;
+        AtlasPacker(int width, int height) { Reset(width, height); }
+
+        // Empty page of the given size
+        void Reset(int width, int height);
+
+        // Place a w x h rectangle: false if it does not fit in the page
+        bool Insert(int w, int h, AtlasRect& outRect);
+
+        int GetWidth() const { return m_width; }
+        int GetHeight() const { return m_height; }
+        // Packed area / page area
+        float GetOccupancy() const;
+
+    private:
+        struct SkylineNode
+        {
+            int x;
+            int y;
+            int width;
+        };
+
+        // Top of a w x h rectangle placed at node 'index' (-1 if it does not fit)
+        int Fit(std::size_t index, int w, int h) const;
+
+        std::vector<SkylineNode> m_skyline;
+        int m_width = 0;
+        int m_height = 0;
+        std::int64_t m_usedArea = 0;
+    };
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,200 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Render Queue Implementation
+ *
+ * Static list rebuilt only when the visible blocks/layers change, dynamic list
+ * radix-sorted every frame.
+ */
+
+#include "RenderQueue.h"
+#include "RenderScene.h"
+#include <algorithm>
+
+namespace Olympe {
+namespace Rendering {
+
+    namespace {
+        // Tags of the static signature entries
+        enum SignatureTag : uint32_t
+        {
+            SIG_GENERATION = 1,
+            SIG_BLOCK = 2,
+            SIG_ITEM = 3
+        };
+
+        struct KeyLess
+        {
+            bool operator()(const RenderItem& item, uint32_t key) const { return item.key < key; }
+            bool operator()(uint32_t key, const RenderItem& item) const { return key < item.key; }
+        };
+    }
+
+    // ---------------------------------------------------------------------
+    // RenderItem factories
+    // ---------------------------------------------------------------------
+
+    RenderItem RenderItem::MakeParallax(float depth, int layerIndex)
+    {
+        RenderItem item;
+        item.type = ParallaxLayer;
+        item.depth = depth;
+        item.key = DepthSortKey(depth);
+        item.parallax.layerIndex = layerIndex;
+        return item;
+    }
+
+    RenderItem RenderItem::MakeTileBatch(Olympe::Rendering::TileBlock* block, const Olympe::Rendering::TileBatch* batch)
+    {
+        RenderItem item;
+        item.type = TileBatch;
+        item.depth = batch->depth;
+        item.key = DepthSortKey(batch->depth);
+        item.tiles.block = block;
+        item.tiles.batch = batch;
+        return item;
+    }
+
+    RenderItem RenderItem::MakeTileBlock(Olympe::Rendering::TileBlock* block)
+    {
+        RenderItem item;
+        item.type = TileBlock;
+        item.depth = block->minDepth;
+        item.key = DepthSortKey(block->minDepth);
+        item.tiles.block = block;
+        item.tiles.batch = nullptr;
+        return item;
+    }
+
+    RenderItem RenderItem::MakeEntity(float depth, EntityID id)
+    {
+        RenderItem item;
+        item.type = Entity;
+        item.depth = depth;
+        item.key = DepthSortKey(depth);
+        item.entity.entityId = id;
+        item.entity.sprite = nullptr;
+        return item;
+    }
+
+    RenderItem RenderItem::MakeSprite(const SceneSprite& sprite)
+    {
+        RenderItem item;
+        item.type = Entity;
+        item.depth = sprite.depth;
+        item.key = sprite.key;
+        item.entity.entityId = sprite.entity;
+        item.entity.sprite = &sprite;
+        return item;
+    }
+
+    // ---------------------------------------------------------------------
+    // Static items
+    // ---------------------------------------------------------------------
+
+    void RenderQueue::BeginStatic(uint32_t geometryGeneration)
+    {
+        m_pendingSignature.clear();
+        m_pendingBlocks.clear();
+        m_pendingItems.clear();
+        m_pendingSignature.push_back(SIG_GENERATION);
+        m_pendingSignature.push_back(geometryGeneration);
+    }
+
+    void RenderQueue::AddStaticBlock(Olympe::Rendering::TileBlock* block)
+    {
+        // A re-baked block has new batches (and batch pointers): its revision changes
+        m_pendingSignature.push_back(SIG_BLOCK);
+        m_pendingSignature.push_back(block->id);
+        m_pendingSignature.push_back(block->revision);
+        m_pendingBlocks.push_back(block);
+    }
+
+    void RenderQueue::AddStaticItem(const RenderItem& item)
+    {
+        m_pendingSignature.push_back(SIG_ITEM);
+        m_pendingSignature.push_back(static_cast<uint32_t>(item.type));
+        m_pendingSignature.push_back(item.type == RenderItem::ParallaxLayer ? static_cast<uint32_t>(item.parallax.layerIndex) : 0u);
+        m_pendingSignature.push_back(item.key);
+        m_pendingItems.push_back(item);
+    }
+
+    void RenderQueue::EndStatic()
+    {
+        if (m_pendingSignature == m_signature)
+            return;
+
+        m_signature.swap(m_pendingSignature);
+        RebuildStatic();
+    }
+
+    void RenderQueue::RebuildStatic()
+    {
+        ++m_staticRebuilds;
+
+        // 1. Every item as submitted (blocks as batches), stable-sorted by depth
+        m_static = m_pendingItems;
+        uint32_t blockIdEnd = 0;
+        for (Olympe::Rendering::TileBlock* block : m_pendingBlocks)
+        {
+            for (const Olympe::Rendering::TileBatch& batch : block->batches)
+                m_static.push_back(RenderItem::MakeTileBatch(block, &batch));
+            blockIdEnd = std::max(blockIdEnd, block->id + 1);
+        }
+        SortByDepthKey(m_static, m_scratch);
+
+        // 2. Flat blocks alone in their depth range become one TileBlock item.
+        // Their batches are the only items in [minDepth, maxDepth], so they are contiguous.
+        m_collapsed.assign(blockIdEnd, 0);
+        bool anyCollapsed = false;
+        for (Olympe::Rendering::TileBlock* block : m_pendingBlocks)
+        {
+            if (!block->flat || block->batches.empty())
+                continue;
+            auto first = std::lower_bound(m_static.begin(), m_static.end(), DepthSortKey(block->minDepth), KeyLess());
+            auto last = std::upper_bound(first, m_static.end(), DepthSortKey(block->maxDepth), KeyLess());
+            if (static_cast<size_t>(last - first) == block->batches.size())
+            {
+                m_collapsed[block->id] = 1;
+                anyCollapsed = true;
+            }
+        }
+        if (!anyCollapsed)
+            return;
+
+        size_t out = 0;
+        for (size_t i = 0; i < m_static.size(); ++i)
+        {
+            const RenderItem& item = m_static[i];
+            if (item.type == RenderItem::TileBatch && m_collapsed[item.tiles.block->id])
+            {
+                if (item.tiles.batch != &item.tiles.block->batches.front())
+                    continue;
+                m_static[out++] = RenderItem::MakeTileBlock(item.tiles.block);
+                continue;
+            }
+            m_static[out++] = item;
+        }
+        m_static.resize(out);
+    }
+
+    // ---------------------------------------------------------------------
+    // Dynamic items
+    // ---------------------------------------------------------------------
+
+    void RenderQueue::SortDynamic()
+    {
+        SortByDepthKey(m_dynamic, m_scratch);
+    }
+
+    void RenderQueue::Clear()
+    {
+        m_signature.clear();
+        m_pendingSignature.clear();
+        m_pendingBlocks.clear();
+        m_pendingItems.clear();
+        m_static.clear();
+        m_dynamic.clear();
+    }
+
+} // namespace Rendering
+} // namespace Olympe
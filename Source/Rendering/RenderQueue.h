@@ -0,0 +1,233 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Render Queue
+ *
+ * Persistent, depth-sorted list of the items drawn by one camera.
+ * Static items (baked tile blocks, parallax layers) keep their depth from frame to frame:
+ * they are sorted once and the sorted list is reused as long as the same blocks and layers
+ * are visible. Dynamic items (entities) are re-sorted every frame with a radix sort on a
+ * 32-bit depth key (insertion sort for short lists), then merged with the static list while
+ * drawing. The per-frame cost is O(visible blocks + dynamic items) instead of a full sort.
+ *
+ * Flat tile blocks with no other static item inside their depth range are stored as one
+ * TileBlock item (render-to-texture cache, see TileBlockCache.h). If a dynamic item falls
+ * inside that range in a given frame, the block is expanded back into its batches.
+ *
+ * Entity items usually point to a SceneSprite of the frame's shared scene (see RenderScene.h),
+ * extracted and sorted once for every view: a view's dynamic list is then already sorted.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "../ECS_Entity.h"
+#include "TileGeometry.h"
+
+namespace Olympe {
+namespace Rendering {
+
+    struct SceneSprite;
+
+    // Order-preserving 32-bit key of a depth (a < b <=> key(a) < key(b))
+    inline uint32_t DepthSortKey(float depth)
+    {
+        uint32_t bits;
+        static_assert(sizeof(bits) == sizeof(depth), "32-bit float expected");
+        std::memcpy(&bits, &depth, sizeof(bits));
+        // Negative floats: reverse the order of their magnitudes; positive: above every negative
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+
+    // Unified render item
+    struct RenderItem
+    {
+        enum Type {
+            ParallaxLayer,    // Image layers (backgrounds/foregrounds)
+            TileBatch,        // Baked tiles of one block (one draw call)
+            TileBlock,        // Whole flat block, drawn from the render-to-texture cache
+            Entity            // Game objects
+        } type;
+
+        float depth;          // Unified sorting key (lower = background)
+        uint32_t key;         // DepthSortKey(depth)
+
+        // Type-specific data
+        union {
+            struct {
+                int layerIndex;
+            } parallax;
+
+            struct {
+                Olympe::Rendering::TileBlock* block;
+                const Olympe::Rendering::TileBatch* batch;
+            } tiles;
+
+            struct {
+                EntityID entityId;
+                const SceneSprite* sprite;    // Drawable state of the frame (nullptr: read the components)
+            } entity;
+        };
+
+        // Factory methods
+        static RenderItem MakeParallax(float depth, int layerIndex);
+        static RenderItem MakeTileBatch(Olympe::Rendering::TileBlock* block, const Olympe::Rendering::TileBatch* batch);
+        static RenderItem MakeTileBlock(Olympe::Rendering::TileBlock* block);
+        static RenderItem MakeEntity(float depth, EntityID id);
+        static RenderItem MakeSprite(const SceneSprite& sprite);
+    };
+
+    class RenderQueue
+    {
+    public:
+        // Lists up to this size are insertion-sorted instead of radix-sorted
+        static const size_t INSERTION_SORT_THRESHOLD = 64;
+
+        // Static items of the frame, submitted between BeginStatic and EndStatic.
+        // The sorted static list is only rebuilt when the submitted set differs from the
+        // previous frame (other blocks, re-baked blocks, other layers or layer depths).
+        void BeginStatic(uint32_t geometryGeneration);
+        void AddStaticBlock(Olympe::Rendering::TileBlock* block);
+        void AddStaticItem(const RenderItem& item);
+        void EndStatic();
+
+        // Dynamic items of the frame, sorted by SortDynamic (no-op if added in depth order)
+        void ClearDynamic() { m_dynamic.clear(); }
+        void AddDynamic(const RenderItem& item) { m_dynamic.push_back(item); }
+        void SortDynamic();
+
+        /**
+         * Visit every item in depth order (static before dynamic on equal depth).
+         * TileBlock items are only reported when no dynamic item sorts inside the block's
+         * depth range; otherwise the block's batches are reported, interleaved with them.
+         */
+        template<typename Visitor>
+        void Visit(Visitor&& visit) const;
+
+        // Drop every item (level unload: blocks are about to be destroyed)
+        void Clear();
+
+        const std::vector<RenderItem>& GetStaticItems() const { return m_static; }
+        const std::vector<RenderItem>& GetDynamicItems() const { return m_dynamic; }
+        uint32_t GetStaticRebuildCount() const { return m_staticRebuilds; }
+
+    private:
+        void RebuildStatic();
+
+        // Identity of the submitted static set: (tag, value) pairs compared between frames
+        std::vector<uint32_t> m_signature;
+        std::vector<uint32_t> m_pendingSignature;
+        std::vector<Olympe::Rendering::TileBlock*> m_pendingBlocks;
+        std::vector<RenderItem> m_pendingItems;
+
+        std::vector<RenderItem> m_static;       // Sorted, kept across frames
+        std::vector<RenderItem> m_dynamic;      // Sorted every frame
+        std::vector<RenderItem> m_scratch;
+        std::vector<uint8_t> m_collapsed;       // Per block id, scratch of RebuildStatic
+        uint32_t m_staticRebuilds = 0;
+    };
+
+    /**
+     * Stable sort of items on their 'key' member (DepthSortKey), with 'scratch' as the
+     * radix sort buffer. Already sorted lists are detected in one pass and left untouched.
+     */
+    template<typename T>
+    void SortByDepthKey(std::vector<T>& items, std::vector<T>& scratch)
+    {
+        const size_t count = items.size();
+        size_t firstUnsorted = 1;
+        while (firstUnsorted < count && items[firstUnsorted - 1].key <= items[firstUnsorted].key)
+            ++firstUnsorted;
+        if (firstUnsorted >= count)
+            return;
+
+        if (count <= RenderQueue::INSERTION_SORT_THRESHOLD)
+        {
+            // Short or nearly sorted lists (entities move a little between frames)
+            for (size_t i = firstUnsorted; i < count; ++i)
+            {
+                if (items[i - 1].key <= items[i].key)
+                    continue;
+                T moved = items[i];
+                size_t j = i;
+                while (j > 0 && items[j - 1].key > moved.key)
+                {
+                    items[j] = items[j - 1];
+                    --j;
+                }
+                items[j] = moved;
+            }
+            return;
+        }
+
+        // LSD radix sort, 4 passes of 8 bits (stable). Passes where every key has
+        // the same byte are skipped, which is common for depths of similar magnitude.
+        scratch.resize(count);
+        T* src = items.data();
+        T* dst = scratch.data();
+        for (uint32_t shift = 0; shift < 32; shift += 8)
+        {
+            size_t offsets[256] = {};
+            for (size_t i = 0; i < count; ++i)
+                ++offsets[(src[i].key >> shift) & 0xFFu];
+            if (offsets[(src[0].key >> shift) & 0xFFu] == count)
+                continue;
+
+            size_t total = 0;
+            for (size_t b = 0; b < 256; ++b)
+            {
+                const size_t n = offsets[b];
+                offsets[b] = total;
+                total += n;
+            }
+            for (size_t i = 0; i < count; ++i)
+                dst[offsets[(src[i].key >> shift) & 0xFFu]++] = src[i];
+            std::swap(src, dst);
+        }
+        if (src != items.data())
+            items.swap(scratch);
+    }
+
+    template<typename Visitor>
+    void RenderQueue::Visit(Visitor&& visit) const
+    {
+        const RenderItem* dyn = m_dynamic.data();
+        const RenderItem* dynEnd = dyn + m_dynamic.size();
+
+        for (const RenderItem& item : m_static)
+        {
+            while (dyn != dynEnd && dyn->key < item.key)
+                visit(*dyn++);
+
+            if (item.type != RenderItem::TileBlock)
+            {
+                visit(item);
+                continue;
+            }
+
+            // Dynamic items before the block are drawn: the next one decides
+            // whether the block's depth range is free
+            Olympe::Rendering::TileBlock* block = item.tiles.block;
+            if (dyn == dynEnd || dyn->key > DepthSortKey(block->maxDepth))
+            {
+                visit(item);
+                continue;
+            }
+            for (const Olympe::Rendering::TileBatch& batch : block->batches)
+            {
+                const uint32_t batchKey = DepthSortKey(batch.depth);
+                while (dyn != dynEnd && dyn->key < batchKey)
+                    visit(*dyn++);
+                visit(RenderItem::MakeTileBatch(block, &batch));
+            }
+        }
+
+        while (dyn != dynEnd)
+            visit(*dyn++);
+    }
+
+} // namespace Rendering
+} // namespace Olympe
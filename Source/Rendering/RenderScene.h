@@ -0,0 +1,58 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Render Scene
+ *
+ * Entity sprites of the current frame, extracted once from the components and shared
+ * by every view (split-screen cameras). Each sprite carries its depth key, culling box
+ * and resolved texture region, and the list is sorted by depth once: a view only culls
+ * the list against its camera, and the sprites it keeps are already in depth order.
+ * The list is read-only between Sort() and the next Clear(), so views can be prepared
+ * in parallel.
+ */
+
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+
+#include "../ECS_Entity.h"
+#include "RenderQueue.h"
+
+namespace Olympe {
+namespace Rendering {
+
+    // Drawable state of an entity sprite for one frame
+    struct SceneSprite
+    {
+        EntityID entity = INVALID_ENTITY_ID;
+        float depth = 0.0f;
+        uint32_t key = 0;                 // DepthSortKey(depth)
+        SDL_FRect worldBounds = { 0.0f, 0.0f, 0.0f, 0.0f };   // Position - hotspot, bounding box size
+        float worldX = 0.0f;              // Entity position (sprite pivot)
+        float worldY = 0.0f;
+        float hotSpotX = 0.0f;
+        float hotSpotY = 0.0f;
+        SDL_Texture* texture = nullptr;   // Atlas page or the sprite itself (nullptr: nothing to draw)
+        SDL_FRect srcRect = { 0.0f, 0.0f, 0.0f, 0.0f };        // Pixels of 'texture'
+        SDL_Color color = { 255, 255, 255, 255 };
+    };
+
+    class RenderScene
+    {
+    public:
+        void Clear() { m_sprites.clear(); }
+        void Add(const SceneSprite& sprite) { m_sprites.push_back(sprite); }
+
+        // Stable sort by depth (submission order on equal depth)
+        void Sort() { SortByDepthKey(m_sprites, m_scratch); }
+
+        const std::vector<SceneSprite>& GetSprites() const { return m_sprites; }
+
+    private:
+        std::vector<SceneSprite> m_sprites;
+        std::vector<SceneSprite> m_scratch;
+    };
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,98 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Sprite Batcher Implementation
+ */
+
+#include "SpriteBatcher.h"
+#include <cmath>
+
+namespace Olympe {
+namespace Rendering {
+
+    void SpriteBatcher::Add(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_FRect& srcRect, const SDL_FRect& destRect,
+                            float angle, const SDL_FPoint& center, const SDL_Color& color)
+    {
+        if (!texture || texture->w <= 0 || texture->h <= 0)
+            return;
+
+        if (texture != m_texture || m_vertices.size() >= MAX_QUADS * 4)
+        {
+            Flush(renderer);
+            m_texture = texture;
+        }
+
+        const float texW = static_cast<float>(texture->w);
+        const float texH = static_cast<float>(texture->h);
+        const float u0 = srcRect.x / texW;
+        const float v0 = srcRect.y / texH;
+        const float u1 = (srcRect.x + srcRect.w) / texW;
+        const float v1 = (srcRect.y + srcRect.h) / texH;
+
+        // Corners relative to the rotation center
+        const float pivotX = destRect.x + center.x;
+        const float pivotY = destRect.y + center.y;
+        const float left = -center.x;
+        const float top = -center.y;
+        const float right = destRect.w - center.x;
+        const float bottom = destRect.h - center.y;
+
+        float cosRot = 1.0f, sinRot = 0.0f;
+        if (angle != 0.0f)
+        {
+            // Clockwise, as SDL_RenderTextureRotated does
+            const float rotRad = angle * (3.14159265358979323846f / 180.0f);
+            cosRot = std::cos(rotRad);
+            sinRot = std::sin(rotRad);
+        }
+
+        // Same modulation as SDL_SetTextureColorMod (alpha unchanged)
+        const SDL_FColor tint = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, 1.0f };
+        const float cornersX[4] = { left, right, left, right };
+        const float cornersY[4] = { top, top, bottom, bottom };
+        const float us[4] = { u0, u1, u0, u1 };
+        const float vs[4] = { v0, v0, v1, v1 };
+        for (int i = 0; i < 4; ++i)
+        {
+            SDL_Vertex vertex;
+            vertex.position.x = pivotX + cornersX[i] * cosRot - cornersY[i] * sinRot;
+            vertex.position.y = pivotY + cornersX[i] * sinRot + cornersY[i] * cosRot;
+            vertex.color = tint;
+            vertex.tex_coord.x = us[i];
+            vertex.tex_coord.y = vs[i];
+            m_vertices.push_back(vertex);
+        }
+        ++m_sprites;
+    }
+
+    void SpriteBatcher::Flush(SDL_Renderer* renderer)
+    {
+        if (m_vertices.empty())
+            return;
+
+        // Shared index pattern (0,1,2 / 2,1,3 per quad), extended to the largest batch
+        const size_t quadCount = m_vertices.size() / 4;
+        const size_t current = m_indices.size() / 6;
+        if (quadCount > current)
+        {
+            m_indices.resize(quadCount * 6);
+            for (size_t q = current; q < quadCount; ++q)
+            {
+                const int v = static_cast<int>(q * 4);
+                int* idx = &m_indices[q * 6];
+                idx[0] = v + 0; idx[1] = v + 1; idx[2] = v + 2;
+                idx[3] = v + 2; idx[4] = v + 1; idx[5] = v + 3;
+            }
+        }
+
+        if (renderer)
+        {
+            SDL_RenderGeometry(renderer, m_texture, m_vertices.data(), static_cast<int>(m_vertices.size()),
+                               m_indices.data(), static_cast<int>(quadCount * 6));
+            ++m_drawCalls;
+        }
+        m_vertices.clear();
+        m_texture = nullptr;
+    }
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,51 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Sprite Batcher
+ *
+ * Collects sprite quads in draw order and submits consecutive quads that share a
+ * texture (usually an atlas page, see TextureAtlas.h) with one SDL_RenderGeometry call.
+ * The sprite color is a vertex color (same result as SDL_SetTextureColorMod), so
+ * sprites with different colors still share a batch.
+ * Flush() must be called before anything else is drawn, to keep the draw order.
+ */
+
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+namespace Olympe {
+namespace Rendering {
+
+    class SpriteBatcher
+    {
+    public:
+        // Quads per SDL_RenderGeometry call at most
+        static const size_t MAX_QUADS = 4096;
+
+        /**
+         * Queue a sprite, as SDL_RenderTextureRotated(renderer, texture, &srcRect, &destRect, angle, &center) draws it.
+         * @param srcRect Pixels of 'texture' (e.g. an atlas region)
+         * @param angle Degrees, clockwise around destRect's origin + center
+         */
+        void Add(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_FRect& srcRect, const SDL_FRect& destRect,
+                 float angle, const SDL_FPoint& center, const SDL_Color& color);
+
+        // Submit the queued quads
+        void Flush(SDL_Renderer* renderer);
+
+        // Statistics since the last ResetStats
+        size_t GetDrawCallCount() const { return m_drawCalls; }
+        size_t GetSpriteCount() const { return m_sprites; }
+        void ResetStats() { m_drawCalls = 0; m_sprites = 0; }
+
+    private:
+        SDL_Texture* m_texture = nullptr;
+        std::vector<SDL_Vertex> m_vertices;
+        std::vector<int> m_indices;      // 6 per quad, grows with the largest batch
+        size_t m_drawCalls = 0;
+        size_t m_sprites = 0;
+    };
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,148 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Texture Atlas Implementation
+ *
+ * Packs sprite textures into render-target pages with the skyline packer and
+ * copies them on the GPU (the source surfaces are gone once textures exist).
+ */
+
+#include "TextureAtlas.h"
+
+namespace Olympe {
+namespace Rendering {
+
+    TextureAtlas::Page* TextureAtlas::CreatePage(SDL_Renderer* renderer)
+    {
+        SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                                 PAGE_SIZE, PAGE_SIZE);
+        if (!texture)
+            return nullptr;
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+        // Transparent page
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+        Uint8 r, g, b, a;
+        SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+        SDL_SetRenderTarget(renderer, texture);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        SDL_SetRenderTarget(renderer, previousTarget);
+        SDL_SetRenderDrawColor(renderer, r, g, b, a);
+
+        Page page;
+        page.texture = texture;
+        page.packer.Reset(PAGE_SIZE, PAGE_SIZE);
+        m_pages.push_back(page);
+        return &m_pages.back();
+    }
+
+    void TextureAtlas::CopyToPage(SDL_Renderer* renderer, SDL_Texture* source, SDL_Texture* page, const SDL_FRect& rect)
+    {
+        // Raw copy: no blending, no modulation (restored afterwards)
+        SDL_BlendMode blendMode;
+        Uint8 r, g, b, a;
+        SDL_GetTextureBlendMode(source, &blendMode);
+        SDL_GetTextureColorMod(source, &r, &g, &b);
+        SDL_GetTextureAlphaMod(source, &a);
+        SDL_SetTextureBlendMode(source, SDL_BLENDMODE_NONE);
+        SDL_SetTextureColorMod(source, 255, 255, 255);
+        SDL_SetTextureAlphaMod(source, 255);
+
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, page);
+
+        // Copies shifted by one pixel fill the border with the sprite's edges,
+        // then the sprite itself overwrites the inside
+        for (int dy = -EXTRUDE; dy <= EXTRUDE; ++dy)
+        {
+            for (int dx = -EXTRUDE; dx <= EXTRUDE; ++dx)
+            {
+                if (dx == 0 && dy == 0) continue;
+                SDL_FRect shifted = { rect.x + dx, rect.y + dy, rect.w, rect.h };
+                SDL_RenderTexture(renderer, source, nullptr, &shifted);
+            }
+        }
+        SDL_RenderTexture(renderer, source, nullptr, &rect);
+
+        SDL_SetRenderTarget(renderer, previousTarget);
+        SDL_SetTextureBlendMode(source, blendMode);
+        SDL_SetTextureColorMod(source, r, g, b);
+        SDL_SetTextureAlphaMod(source, a);
+    }
+
+    bool TextureAtlas::Add(SDL_Renderer* renderer, SDL_Texture* source)
+    {
+        if (!renderer || !source)
+            return false;
+        if (m_regions.find(source) != m_regions.end())
+            return true;
+        if (source->w <= 0 || source->h <= 0 || source->w > MAX_SPRITE_SIZE || source->h > MAX_SPRITE_SIZE)
+            return false;
+
+        const int cellW = source->w + 2 * EXTRUDE;
+        const int cellH = source->h + 2 * EXTRUDE;
+        AtlasRect cell;
+        Page* page = nullptr;
+        for (Page& candidate : m_pages)
+        {
+            if (candidate.packer.Insert(cellW, cellH, cell))
+            {
+                page = &candidate;
+                break;
+            }
+        }
+        if (!page)
+        {
+            page = CreatePage(renderer);
+            if (!page || !page->packer.Insert(cellW, cellH, cell))
+                return false;
+        }
+
+        Entry entry;
+        entry.source = source;
+        entry.region.page = page->texture;
+        entry.region.rect.x = static_cast<float>(cell.x + EXTRUDE);
+        entry.region.rect.y = static_cast<float>(cell.y + EXTRUDE);
+        entry.region.rect.w = static_cast<float>(source->w);
+        entry.region.rect.h = static_cast<float>(source->h);
+        CopyToPage(renderer, source, page->texture, entry.region.rect);
+
+        m_regions.emplace(source, entry);
+        return true;
+    }
+
+    void TextureAtlas::Remove(const SDL_Texture* source)
+    {
+        m_regions.erase(source);
+    }
+
+    bool TextureAtlas::Find(const SDL_Texture* source, AtlasRegion& outRegion) const
+    {
+        auto it = m_regions.find(source);
+        if (it == m_regions.end())
+            return false;
+        outRegion = it->second.region;
+        return true;
+    }
+
+    void TextureAtlas::Refresh(SDL_Renderer* renderer)
+    {
+        if (!renderer)
+            return;
+        for (auto& kv : m_regions)
+            CopyToPage(renderer, kv.second.source, kv.second.region.page, kv.second.region.rect);
+    }
+
+    void TextureAtlas::Clear()
+    {
+        for (Page& page : m_pages)
+        {
+            if (page.texture)
+                SDL_DestroyTexture(page.texture);
+        }
+        m_pages.clear();
+        m_regions.clear();
+    }
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,82 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Texture Atlas
+ *
+ * Sprite textures copied at load time into shared atlas pages (render-target textures),
+ * so sprites drawn one after another use the same texture and can be batched
+ * (see SpriteBatcher.h). Each sprite is surrounded by a 1-pixel copy of its own edges,
+ * so linear filtering at the border samples the sprite and not its neighbours.
+ * Pages are render targets: their content is lost on SDL_EVENT_RENDER_TARGETS_RESET,
+ * call Refresh() to copy the sources again.
+ */
+
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <unordered_map>
+#include <vector>
+
+#include "AtlasPacker.h"
+
+namespace Olympe {
+namespace Rendering {
+
+    // Location of a sprite inside the atlas
+    struct AtlasRegion
+    {
+        SDL_Texture* page = nullptr;
+        SDL_FRect rect = { 0.0f, 0.0f, 0.0f, 0.0f };   // Pixels, whole source texture
+    };
+
+    class TextureAtlas
+    {
+    public:
+        static const int PAGE_SIZE = 2048;
+        // Larger sprites stay in their own texture
+        static const int MAX_SPRITE_SIZE = 512;
+        // Edge copy around each sprite
+        static const int EXTRUDE = 1;
+
+        TextureAtlas() = default;
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        // Copy a texture into a page (no-op if already there): false if it is not atlased
+        bool Add(SDL_Renderer* renderer, SDL_Texture* source);
+
+        // Forget a texture (about to be destroyed); its area is not reused
+        void Remove(const SDL_Texture* source);
+
+        bool Find(const SDL_Texture* source, AtlasRegion& outRegion) const;
+
+        // Copy every source again (render targets were reset)
+        void Refresh(SDL_Renderer* renderer);
+
+        // Destroy every page
+        void Clear();
+
+        size_t GetPageCount() const { return m_pages.size(); }
+        size_t GetSpriteCount() const { return m_regions.size(); }
+
+    private:
+        struct Page
+        {
+            SDL_Texture* texture = nullptr;
+            AtlasPacker packer;
+        };
+
+        struct Entry
+        {
+            SDL_Texture* source = nullptr;
+            AtlasRegion region;
+        };
+
+        Page* CreatePage(SDL_Renderer* renderer);
+        static void CopyToPage(SDL_Renderer* renderer, SDL_Texture* source, SDL_Texture* page, const SDL_FRect& rect);
+
+        std::vector<Page> m_pages;
+        std::unordered_map<const SDL_Texture*, Entry> m_regions;
+    };
+
+} // namespace Rendering
+} // namespace Olympe
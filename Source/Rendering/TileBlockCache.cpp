@@ -0,0 +1,172 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Tile Block Cache Implementation
+ *
+ * Renders flat tile blocks into target textures per zoom level and draws
+ * them back as single quads.
+ */
+
+#include "TileBlockCache.h"
+#include <cmath>
+
+namespace Olympe {
+namespace Rendering {
+
+    void TileBlockCache::Clear()
+    {
+        for (BlockSlot& slot : m_slots)
+        {
+            for (Entry& entry : slot.entries)
+                Release(entry);
+        }
+        m_slots.clear();
+    }
+
+    void TileBlockCache::Release(Entry& entry)
+    {
+        if (entry.texture)
+        {
+            SDL_DestroyTexture(entry.texture);
+            --m_textureCount;
+        }
+        entry = Entry();
+    }
+
+    TileBlockCache::Entry* TileBlockCache::FindEntry(BlockSlot& slot, float zoom, uint32_t revision)
+    {
+        Entry* found = nullptr;
+        for (Entry& entry : slot.entries)
+        {
+            if (!entry.texture) continue;
+
+            // Rendered from an older bake of the block (runtime tile change)
+            if (entry.revision != revision)
+            {
+                Release(entry);
+                continue;
+            }
+            if (entry.zoom == zoom)
+                found = &entry;
+        }
+        return found;
+    }
+
+    TileBlockCache::Entry* TileBlockCache::AllocateEntry(BlockSlot& slot)
+    {
+        // Free entry of this block, or its least recently used zoom level
+        Entry* target = &slot.entries[0];
+        for (Entry& entry : slot.entries)
+        {
+            if (!entry.texture) { target = &entry; break; }
+            if (entry.lastUse < target->lastUse) target = &entry;
+        }
+        Release(*target);
+
+        // Global budget: evict the least recently used texture of any block
+        if (m_textureCount >= MAX_TEXTURES)
+        {
+            Entry* oldest = nullptr;
+            for (BlockSlot& other : m_slots)
+            {
+                for (Entry& entry : other.entries)
+                {
+                    if (entry.texture && (!oldest || entry.lastUse < oldest->lastUse))
+                        oldest = &entry;
+                }
+            }
+            if (oldest) Release(*oldest);
+        }
+        return target;
+    }
+
+    bool TileBlockCache::Render(SDL_Renderer* renderer, TileGeometry& geometry, TileBlock& block, float zoom, Entry& entry)
+    {
+        const float width = std::ceil(block.worldBounds.w * zoom);
+        const float height = std::ceil(block.worldBounds.h * zoom);
+        if (width <= 0.0f || height <= 0.0f || width > MAX_TEXTURE_SIZE || height > MAX_TEXTURE_SIZE)
+            return false;
+
+        SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                                 static_cast<int>(width), static_cast<int>(height));
+        if (!texture)
+            return false;
+
+        // Tiles blended onto a transparent target give premultiplied colors
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+
+        // Viewport and clip rect are per render target: the camera's state comes back with it
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+        Uint8 r, g, b, a;
+        SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+
+        SDL_SetRenderTarget(renderer, texture);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+
+        // Block bounds' top-left corner maps to the texture origin
+        TileCameraKey local;
+        local.worldX = block.worldBounds.x;
+        local.worldY = block.worldBounds.y;
+        local.zoom = zoom;
+        geometry.DrawBlock(renderer, block, TileBlock::OFFSCREEN_VIEW, local);
+
+        SDL_SetRenderTarget(renderer, previousTarget);
+        SDL_SetRenderDrawColor(renderer, r, g, b, a);
+
+        entry.texture = texture;
+        entry.zoom = zoom;
+        entry.revision = block.revision;
+        entry.width = width;
+        entry.height = height;
+        ++m_textureCount;
+        return true;
+    }
+
+    bool TileBlockCache::Draw(SDL_Renderer* renderer, TileGeometry& geometry, TileBlock& block, int view, const TileCameraKey& camera)
+    {
+        if (!block.flat || block.batches.empty() || camera.zoom <= 0.0f || view < 0 || view >= TileBlock::MAX_VIEWS)
+            return false;
+
+        // Rebuilt geometry: block ids now refer to other blocks
+        if (m_generation != geometry.GetGeneration())
+        {
+            Clear();
+            m_generation = geometry.GetGeneration();
+        }
+        if (m_slots.size() < geometry.GetBlockCount())
+            m_slots.resize(geometry.GetBlockCount());
+        if (block.id >= m_slots.size())
+            return false;
+
+        BlockSlot& slot = m_slots[block.id];
+        float& requestedZoom = slot.requestedZoom[view];
+        Entry* entry = FindEntry(slot, camera.zoom, block.revision);
+        if (!entry)
+        {
+            // Only cache a zoom level the view requested twice in a row (not while zooming)
+            const bool stableZoom = (requestedZoom == camera.zoom);
+            requestedZoom = camera.zoom;
+            if (!stableZoom)
+                return false;
+
+            entry = AllocateEntry(slot);
+            if (!Render(renderer, geometry, block, camera.zoom, *entry))
+                return false;
+        }
+        requestedZoom = camera.zoom;
+        entry->lastUse = ++m_useCounter;
+
+        // Same screen transform and rotation as the block's geometry
+        SDL_FRect dest;
+        dest.x = (block.worldBounds.x - camera.worldX) * camera.zoom - camera.offsetX + camera.viewportW / 2.0f;
+        dest.y = (block.worldBounds.y - camera.worldY) * camera.zoom - camera.offsetY + camera.viewportH / 2.0f;
+        dest.w = entry->width;
+        dest.h = entry->height;
+        SDL_FPoint pivot = { camera.viewportW / 2.0f - dest.x, camera.viewportH / 2.0f - dest.y };
+
+        SDL_RenderTextureRotated(renderer, entry->texture, nullptr, &dest, camera.rotation, &pivot, SDL_FLIP_NONE);
+        return true;
+    }
+
+} // namespace Rendering
+} // namespace Olympe
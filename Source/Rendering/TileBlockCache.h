@@ -0,0 +1,79 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Tile Block Cache
+ *
+ * Render-to-texture cache for baked tile blocks (see TileGeometry.h).
+ * A block is rendered once into a target texture per zoom level, then drawn with a
+ * single textured quad while the zoom stays the same. Entries are dropped when the
+ * block is re-baked (runtime tile change), when the geometry is rebuilt, or by LRU
+ * eviction once MAX_TEXTURES is reached.
+ *
+ * Only flat blocks are cacheable (tiles inside their own cells, so the draw order
+ * inside the block does not matter), and the caller only uses the cache for blocks
+ * with no other render item (entity, parallax layer, overlapping tiles) inside their
+ * depth range, so the depth sort stays exact.
+ */
+
+#pragma once
+
+#include "TileGeometry.h"
+
+namespace Olympe {
+namespace Rendering {
+
+    class TileBlockCache
+    {
+    public:
+        // Cached textures kept across all blocks and zoom levels
+        static const size_t MAX_TEXTURES = 256;
+        // Zoom levels kept per block (e.g. split-screen cameras at different zooms)
+        static const size_t ZOOMS_PER_BLOCK = 2;
+        // Larger blocks (in pixels at the cached zoom) are drawn from geometry
+        static const int MAX_TEXTURE_SIZE = 4096;
+
+        /**
+         * Draw a block through its cached texture.
+         * The texture is created the second time in a row a view draws the block at the same
+         * zoom, so a zoom animation does not re-render blocks every frame. Each view has its own
+         * "previous zoom", so split-screen cameras at different zooms each get their texture.
+         * @param view Screen-space slot of the camera (0..TileBlock::MAX_VIEWS-1)
+         * @return false if the block was not drawn (caller draws its batches instead)
+         */
+        bool Draw(SDL_Renderer* renderer, TileGeometry& geometry, TileBlock& block, int view, const TileCameraKey& camera);
+
+        // Destroy every cached texture (textures belong to the renderer: call it before the
+        // renderer is destroyed, e.g. on level unload; leftovers are freed with the renderer)
+        void Clear();
+
+        size_t GetTextureCount() const { return m_textureCount; }
+
+    private:
+        struct Entry
+        {
+            SDL_Texture* texture = nullptr;
+            float zoom = 0.0f;
+            uint32_t revision = 0;    // Block revision the texture was rendered from
+            uint64_t lastUse = 0;
+            float width = 0.0f;       // Texture size in pixels
+            float height = 0.0f;
+        };
+
+        struct BlockSlot
+        {
+            Entry entries[ZOOMS_PER_BLOCK];
+            float requestedZoom[TileBlock::MAX_VIEWS] = {};   // Zoom of each view's previous request
+        };
+
+        Entry* FindEntry(BlockSlot& slot, float zoom, uint32_t revision);
+        Entry* AllocateEntry(BlockSlot& slot);
+        void Release(Entry& entry);
+        bool Render(SDL_Renderer* renderer, TileGeometry& geometry, TileBlock& block, float zoom, Entry& entry);
+
+        std::vector<BlockSlot> m_slots;     // Indexed by block id
+        uint32_t m_generation = 0;          // Geometry generation the slots belong to
+        size_t m_textureCount = 0;
+        uint64_t m_useCounter = 0;
+    };
+
+} // namespace Rendering
+} // namespace Olympe
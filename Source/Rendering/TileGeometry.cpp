@@ -0,0 +1,352 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Tile Geometry Implementation
+ *
+ * Bakes tile chunks into world-space quads once, then submits them per batch
+ * through SDL_RenderGeometry.
+ */
+
+#include "TileGeometry.h"
+#include "IsometricRenderer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Olympe {
+namespace Rendering {
+
+    TileMapOrientation ParseTileMapOrientation(const std::string& orientation)
+    {
+        if (orientation == "isometric") return TileMapOrientation::Isometric;
+        if (orientation == "hexagonal") return TileMapOrientation::Hexagonal;
+        return TileMapOrientation::Orthogonal;
+    }
+
+    bool TileCameraKey::operator==(const TileCameraKey& other) const
+    {
+        return worldX == other.worldX && worldY == other.worldY && zoom == other.zoom
+            && rotation == other.rotation && offsetX == other.offsetX && offsetY == other.offsetY
+            && viewportW == other.viewportW && viewportH == other.viewportH;
+    }
+
+    Affine2D TileCameraKey::GetWorldToScreen() const
+    {
+        // Relative to the camera, zoomed, shifted by the offset around the viewport center,
+        // then rotated clockwise around that center (as SDL_RenderTextureRotated does)
+        const float centerX = viewportW / 2.0f;
+        const float centerY = viewportH / 2.0f;
+        return Affine2D::Translate(centerX, centerY)
+            * Affine2D::RotateScale(rotation, 1.0f)
+            * Affine2D::Translate(-offsetX, -offsetY)
+            * Affine2D::RotateScale(0.0f, zoom)
+            * Affine2D::Translate(-worldX, -worldY);
+    }
+
+    void TileGeometry::Invalidate()
+    {
+        m_blocks.clear();
+        m_chunkBlocks.clear();
+        m_chunks = nullptr;
+        m_built = false;
+        ++m_generation;
+    }
+
+    size_t TileGeometry::GetBatchCount() const
+    {
+        size_t count = 0;
+        for (const TileBlock& block : m_blocks)
+            count += block.batches.size();
+        return count;
+    }
+
+    SDL_FRect TileGeometry::GetWorldBounds() const
+    {
+        bool any = false;
+        float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+        for (const TileBlock& block : m_blocks)
+        {
+            if (block.batches.empty()) continue;
+            const SDL_FRect& b = block.worldBounds;
+            minX = any ? std::min(minX, b.x) : b.x;
+            minY = any ? std::min(minY, b.y) : b.y;
+            maxX = any ? std::max(maxX, b.x + b.w) : b.x + b.w;
+            maxY = any ? std::max(maxY, b.y + b.h) : b.y + b.h;
+            any = true;
+        }
+        return SDL_FRect{ minX, minY, maxX - minX, maxY - minY };
+    }
+
+    void TileGeometry::Build(const std::vector<TileChunk>& chunks, TileMapOrientation orientation,
+                             int tileWidth, int tileHeight,
+                             const TileResolver& resolveTile, const TileDepthFunction& tileDepth)
+    {
+        Invalidate();
+        m_chunks = &chunks;
+        m_orientation = orientation;
+        m_tileWidth = tileWidth;
+        m_tileHeight = tileHeight;
+        m_resolveTile = resolveTile;
+        m_tileDepth = tileDepth;
+
+        m_chunkBlocks.resize(chunks.size());
+        size_t blockCount = 0;
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            ChunkBlocks& grid = m_chunkBlocks[i];
+            grid.firstBlock = static_cast<uint32_t>(blockCount);
+            grid.blocksX = (std::max(chunks[i].width, 0) + BLOCK_SIZE - 1) / BLOCK_SIZE;
+            grid.blocksY = (std::max(chunks[i].height, 0) + BLOCK_SIZE - 1) / BLOCK_SIZE;
+            blockCount += static_cast<size_t>(grid.blocksX) * grid.blocksY;
+        }
+        m_blocks.resize(blockCount);
+
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            const ChunkBlocks& grid = m_chunkBlocks[i];
+            for (int by = 0; by < grid.blocksY; ++by)
+            {
+                for (int bx = 0; bx < grid.blocksX; ++bx)
+                {
+                    const uint32_t id = grid.firstBlock + by * grid.blocksX + bx;
+                    m_blocks[id].id = id;
+                    BakeBlock(chunks[i], bx * BLOCK_SIZE, by * BLOCK_SIZE, m_blocks[id]);
+                }
+            }
+        }
+
+        m_built = true;
+    }
+
+    bool TileGeometry::RebakeTile(size_t chunkIndex, int localX, int localY)
+    {
+        if (!m_built || !m_chunks || chunkIndex >= m_chunkBlocks.size() || chunkIndex >= m_chunks->size())
+            return false;
+
+        const ChunkBlocks& grid = m_chunkBlocks[chunkIndex];
+        const int bx = localX / BLOCK_SIZE;
+        const int by = localY / BLOCK_SIZE;
+        if (localX < 0 || localY < 0 || bx >= grid.blocksX || by >= grid.blocksY)
+            return false;
+
+        BakeBlock((*m_chunks)[chunkIndex], bx * BLOCK_SIZE, by * BLOCK_SIZE, m_blocks[grid.firstBlock + by * grid.blocksX + bx]);
+        return true;
+    }
+
+    void TileGeometry::UpdateQuadIndices(uint32_t quadCount)
+    {
+        // Every batch starts at its own vertex offset, so one index pattern serves all
+        const uint32_t current = static_cast<uint32_t>(m_quadIndices.size() / 6);
+        if (quadCount <= current) return;
+
+        m_quadIndices.resize(static_cast<size_t>(quadCount) * 6);
+        for (uint32_t q = current; q < quadCount; ++q)
+        {
+            const int v = static_cast<int>(q * 4);
+            int* idx = &m_quadIndices[q * 6];
+            idx[0] = v + 0; idx[1] = v + 1; idx[2] = v + 2;
+            idx[3] = v + 2; idx[4] = v + 1; idx[5] = v + 3;
+        }
+    }
+
+    void TileGeometry::BakeBlock(const TileChunk& chunk, int localX0, int localY0, TileBlock& block)
+    {
+        switch (m_orientation)
+        {
+            case TileMapOrientation::Isometric: BakeBlockTiles<TileMapOrientation::Isometric>(chunk, localX0, localY0, block); break;
+            case TileMapOrientation::Hexagonal: BakeBlockTiles<TileMapOrientation::Hexagonal>(chunk, localX0, localY0, block); break;
+            default: BakeBlockTiles<TileMapOrientation::Orthogonal>(chunk, localX0, localY0, block); break;
+        }
+    }
+
+    template <TileMapOrientation Orientation>
+    void TileGeometry::BakeBlockTiles(const TileChunk& chunk, int localX0, int localY0, TileBlock& block)
+    {
+        typedef TileProjection<Orientation> Projection;
+        const int tileWidth = m_tileWidth;
+        const int tileHeight = m_tileHeight;
+
+        struct BakedTile
+        {
+            float depth;
+            int band;
+            int worldX, worldY;
+            uint32_t gid;
+            SDL_Texture* texture;
+            SDL_Rect srcRect;
+            int offsetX, offsetY;
+        };
+
+        const int localX1 = std::min(localX0 + BLOCK_SIZE, chunk.width) - 1;
+        const int localY1 = std::min(localY0 + BLOCK_SIZE, chunk.height) - 1;
+        block.bounds.minX = chunk.x + localX0;
+        block.bounds.minY = chunk.y + localY0;
+        block.bounds.maxX = chunk.x + localX1;
+        block.bounds.maxY = chunk.y + localY1;
+
+        std::vector<BakedTile> tiles;
+        tiles.reserve(static_cast<size_t>(BLOCK_SIZE) * BLOCK_SIZE);
+        for (int y = localY0; y <= localY1; ++y)
+        {
+            for (int x = localX0; x <= localX1; ++x)
+            {
+                const size_t tileIndex = static_cast<size_t>(y) * chunk.width + x;
+                if (tileIndex >= chunk.tileGIDs.size()) continue;
+
+                const uint32_t gid = chunk.tileGIDs[tileIndex];
+                if (gid == 0) continue;
+
+                BakedTile tile;
+                if (!m_resolveTile(gid, tile.texture, tile.srcRect, tile.offsetX, tile.offsetY) || !tile.texture)
+                    continue;
+
+                tile.worldX = chunk.x + x;
+                tile.worldY = chunk.y + y;
+                tile.gid = gid;
+                tile.depth = m_tileDepth(tile.worldX, tile.worldY, chunk.zOrder);
+                tile.band = Projection::DepthBand(tile.worldX, tile.worldY);
+                tiles.push_back(tile);
+            }
+        }
+
+        // Same order the per-tile path drew them in
+        std::stable_sort(tiles.begin(), tiles.end(),
+            [](const BakedTile& a, const BakedTile& b) { return a.depth < b.depth; });
+
+        ++block.revision;
+        block.batches.clear();
+        for (TileScreenVertices& screen : block.views)
+            screen.valid = false;
+        block.flat = true;
+        block.minDepth = tiles.empty() ? 0.0f : tiles.front().depth;
+        block.maxDepth = tiles.empty() ? 0.0f : tiles.back().depth;
+        float boundsMinX = 0.0f, boundsMinY = 0.0f, boundsMaxX = 0.0f, boundsMaxY = 0.0f;
+
+        block.worldVertices.resize(tiles.size() * 4);
+        for (size_t i = 0; i < tiles.size(); ++i)
+        {
+            const BakedTile& tile = tiles[i];
+
+            // Quad in world space, same anchoring as the per-tile path
+            float left, top;
+            Projection::QuadOrigin(tile.worldX, tile.worldY, tile.srcRect.w, tile.srcRect.h, tileWidth, tileHeight, left, top);
+            left += tile.offsetX;
+            top += tile.offsetY;
+            const float right = left + tile.srcRect.w;
+            const float bottom = top + tile.srcRect.h;
+
+            boundsMinX = (i == 0) ? left : std::min(boundsMinX, left);
+            boundsMinY = (i == 0) ? top : std::min(boundsMinY, top);
+            boundsMaxX = (i == 0) ? right : std::max(boundsMaxX, right);
+            boundsMaxY = (i == 0) ? bottom : std::max(boundsMaxY, bottom);
+            // A tile larger than its cell or shifted by an offset overlaps its neighbours,
+            // so the draw order inside the layer matters
+            if (tile.srcRect.w != tileWidth || tile.srcRect.h != tileHeight || tile.offsetX != 0 || tile.offsetY != 0)
+                block.flat = false;
+
+            float texW = 1.0f, texH = 1.0f;
+            SDL_GetTextureSize(tile.texture, &texW, &texH);
+            float u0 = tile.srcRect.x / texW;
+            float v0 = tile.srcRect.y / texH;
+            float u1 = (tile.srcRect.x + tile.srcRect.w) / texW;
+            float v1 = (tile.srcRect.y + tile.srcRect.h) / texH;
+            // Diagonal flips are not applied (same as the per-tile path)
+            if (tile.gid & FLIPPED_HORIZONTALLY_FLAG) std::swap(u0, u1);
+            if (tile.gid & FLIPPED_VERTICALLY_FLAG) std::swap(v0, v1);
+
+            const SDL_FColor white = { 1.0f, 1.0f, 1.0f, 1.0f };
+            SDL_Vertex* quad = &block.worldVertices[i * 4];
+            quad[0] = { { left, top }, white, { u0, v0 } };
+            quad[1] = { { right, top }, white, { u1, v0 } };
+            quad[2] = { { left, bottom }, white, { u0, v1 } };
+            quad[3] = { { right, bottom }, white, { u1, v1 } };
+
+            // Extend the current batch while texture and band stay the same
+            if (i > 0 && tile.texture == tiles[i - 1].texture && tile.band == tiles[i - 1].band)
+            {
+                ++block.batches.back().quadCount;
+            }
+            else
+            {
+                TileBatch batch;
+                batch.texture = tile.texture;
+                batch.depth = tile.depth;
+                batch.firstVertex = static_cast<uint32_t>(i * 4);
+                batch.quadCount = 1;
+                block.batches.push_back(batch);
+            }
+        }
+
+        block.worldBounds = { boundsMinX, boundsMinY, boundsMaxX - boundsMinX, boundsMaxY - boundsMinY };
+        for (const TileBatch& batch : block.batches)
+            UpdateQuadIndices(batch.quadCount);
+    }
+
+    void TileGeometry::CollectVisibleBlocks(const TileChunkIndex& chunkIndex, const TileRect& range,
+                                            std::vector<TileBlock*>& outBlocks, std::vector<uint32_t>& chunkScratch)
+    {
+        outBlocks.clear();
+        if (!m_built) return;
+
+        chunkIndex.CollectChunks(range, chunkScratch);
+        for (uint32_t chunk : chunkScratch)
+        {
+            if (chunk >= m_chunkBlocks.size()) continue;
+            const ChunkBlocks& grid = m_chunkBlocks[chunk];
+
+            for (int by = 0; by < grid.blocksY; ++by)
+            {
+                for (int bx = 0; bx < grid.blocksX; ++bx)
+                {
+                    TileBlock& block = m_blocks[grid.firstBlock + by * grid.blocksX + bx];
+                    if (block.batches.empty()) continue;
+                    if (block.bounds.minX > range.maxX || block.bounds.maxX < range.minX ||
+                        block.bounds.minY > range.maxY || block.bounds.maxY < range.minY)
+                        continue;
+                    outBlocks.push_back(&block);
+                }
+            }
+        }
+    }
+
+    void TileGeometry::TransformVertices(const SDL_Vertex* in, SDL_Vertex* out, size_t count, const TileCameraKey& camera)
+    {
+        const Affine2D m = camera.GetWorldToScreen();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float x = in[i].position.x;
+            const float y = in[i].position.y;
+            out[i].position.x = m.m00 * x + m.m01 * y + m.m02;
+            out[i].position.y = m.m10 * x + m.m11 * y + m.m12;
+            out[i].color = in[i].color;
+            out[i].tex_coord = in[i].tex_coord;
+        }
+    }
+
+    void TileGeometry::UpdateScreenVertices(TileBlock& block, int view, const TileCameraKey& camera)
+    {
+        TileScreenVertices& screen = block.views[view];
+        if (screen.valid && screen.cameraKey == camera && screen.vertices.size() == block.worldVertices.size())
+            return;
+
+        screen.vertices.resize(block.worldVertices.size());
+        TransformVertices(block.worldVertices.data(), screen.vertices.data(), block.worldVertices.size(), camera);
+        screen.cameraKey = camera;
+        screen.valid = true;
+    }
+
+    void TileGeometry::DrawBatch(SDL_Renderer* renderer, TileBlock& block, const TileBatch& batch, int view, const TileCameraKey& camera)
+    {
+        UpdateScreenVertices(block, view, camera);
+
+        SDL_RenderGeometry(renderer, batch.texture,
+                           &block.views[view].vertices[batch.firstVertex], static_cast<int>(batch.quadCount * 4),
+                           m_quadIndices.data(), static_cast<int>(batch.quadCount * 6));
+    }
+
+    void TileGeometry::DrawBlock(SDL_Renderer* renderer, TileBlock& block, int view, const TileCameraKey& camera)
+    {
+        for (const TileBatch& batch : block.batches)
+            DrawBatch(renderer, block, batch, view, camera);
+    }
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,166 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Tile Geometry
+ *
+ * Static tile layers baked into vertex batches.
+ * Each tile chunk is split into blocks of BLOCK_SIZE x BLOCK_SIZE tiles. A block holds the
+ * world-space quads of its tiles (UVs and flips resolved at bake time) grouped into batches:
+ * runs of consecutive tiles, in depth order, that share a texture and a depth band
+ * (isometric diagonal or orthogonal row). A batch is drawn with one SDL_RenderGeometry call,
+ * and the screen-space vertices of a block are only recomputed when the camera changes.
+ * Each view (split-screen camera) has its own screen-space copy, so views can be
+ * transformed in parallel and do not invalidate each other every frame.
+ * Blocks can be re-baked one at a time after a runtime tile change (RebakeTile).
+ */
+
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../TileChunkIndex.h"
+#include "Affine2D.h"
+#include "TileProjection.h"
+
+namespace Olympe {
+namespace Rendering {
+
+    // Camera parameters the screen-space vertices depend on
+    struct TileCameraKey
+    {
+        float worldX = 0.0f;
+        float worldY = 0.0f;
+        float zoom = 1.0f;
+        float rotation = 0.0f;     // Degrees, around the viewport center
+        float offsetX = 0.0f;      // Screen offset (control + shake)
+        float offsetY = 0.0f;
+        float viewportW = 0.0f;
+        float viewportH = 0.0f;
+
+        bool operator==(const TileCameraKey& other) const;
+
+        // World to screen matrix of these parameters
+        Affine2D GetWorldToScreen() const;
+        bool operator!=(const TileCameraKey& other) const { return !(*this == other); }
+    };
+
+    // Run of quads drawn with one SDL_RenderGeometry call
+    struct TileBatch
+    {
+        SDL_Texture* texture = nullptr;
+        float depth = 0.0f;          // Depth of the first tile (sorting key)
+        uint32_t firstVertex = 0;    // Offset in the block's vertex array (4 per quad)
+        uint32_t quadCount = 0;
+    };
+
+    // Screen-space copy of a block's vertices for the last camera of one view
+    struct TileScreenVertices
+    {
+        std::vector<SDL_Vertex> vertices;
+        TileCameraKey cameraKey;
+        bool valid = false;
+    };
+
+    // Baked tiles of a BLOCK_SIZE x BLOCK_SIZE area of one chunk
+    struct TileBlock
+    {
+        // Views with their own screen-space copy (split-screen cameras), then render-to-texture
+        static const int MAX_VIEWS = 4;
+        static const int OFFSCREEN_VIEW = MAX_VIEWS;
+
+        uint32_t id = 0;                          // Index in the geometry's block list
+        uint32_t revision = 0;                    // Incremented every time the block is baked
+        TileRect bounds;                          // World tile coordinates (inclusive)
+        SDL_FRect worldBounds = { 0.0f, 0.0f, 0.0f, 0.0f };  // Bounding box of the quads (world space)
+        float minDepth = 0.0f;                    // Depth range of the tiles
+        float maxDepth = 0.0f;
+        bool flat = true;                         // Every tile stays inside its own cell (no overlap)
+        std::vector<SDL_Vertex> worldVertices;    // Quads in world space
+        std::vector<TileBatch> batches;           // Ascending depth
+
+        // Screen-space copies, indexed by view (0..MAX_VIEWS-1, OFFSCREEN_VIEW)
+        TileScreenVertices views[MAX_VIEWS + 1];
+    };
+
+    class TileGeometry
+    {
+    public:
+        static const int BLOCK_SIZE = 16;
+
+        // Render data of a tile: false if the GID has no drawable tile
+        using TileResolver = std::function<bool(uint32_t gid, SDL_Texture*& texture, SDL_Rect& srcRect,
+                                                int& tileoffsetX, int& tileoffsetY)>;
+        // Sorting depth of a tile
+        using TileDepthFunction = std::function<float(int worldX, int worldY, int zOrder)>;
+
+        // Bake every chunk (call once after the level loaded, see IsBuilt/Invalidate).
+        // The chunk list and both callbacks are kept (and must stay valid) for RebakeTile.
+        void Build(const std::vector<TileChunk>& chunks, TileMapOrientation orientation,
+                   int tileWidth, int tileHeight,
+                   const TileResolver& resolveTile, const TileDepthFunction& tileDepth);
+
+        void Invalidate();
+        bool IsBuilt() const { return m_built; }
+        // Changes on every Build/Invalidate (caches keyed on blocks compare it)
+        uint32_t GetGeneration() const { return m_generation; }
+
+        // Re-bake the block holding a tile after its GID changed in the chunk list
+        bool RebakeTile(size_t chunkIndex, int localX, int localY);
+
+        // Blocks of the chunks overlapping 'range' that overlap it themselves.
+        // Only reads the geometry: views can collect in parallel, each with its own scratch.
+        void CollectVisibleBlocks(const TileChunkIndex& chunkIndex, const TileRect& range,
+                                  std::vector<TileBlock*>& outBlocks, std::vector<uint32_t>& chunkScratch);
+
+        // Transform a block for a view if the camera changed since its last draw in that view.
+        // Views with different indices can be updated in parallel (no renderer access).
+        static void UpdateScreenVertices(TileBlock& block, int view, const TileCameraKey& camera);
+
+        // Draw one batch of a block (transforms the block first if the camera changed)
+        void DrawBatch(SDL_Renderer* renderer, TileBlock& block, const TileBatch& batch, int view, const TileCameraKey& camera);
+
+        // Draw every batch of a block in order
+        void DrawBlock(SDL_Renderer* renderer, TileBlock& block, int view, const TileCameraKey& camera);
+
+        // World-space to screen-space transform used for the vertices (one matrix, no branch per vertex)
+        static void TransformVertices(const SDL_Vertex* in, SDL_Vertex* out, size_t count, const TileCameraKey& camera);
+
+        // Bounding box of every baked tile (world space, empty before Build)
+        SDL_FRect GetWorldBounds() const;
+
+        size_t GetBlockCount() const { return m_blocks.size(); }
+        size_t GetBatchCount() const;
+
+    private:
+        struct ChunkBlocks
+        {
+            uint32_t firstBlock = 0;
+            int blocksX = 0;
+            int blocksY = 0;
+        };
+
+        void BakeBlock(const TileChunk& chunk, int localX0, int localY0, TileBlock& block);
+        template <TileMapOrientation Orientation>
+        void BakeBlockTiles(const TileChunk& chunk, int localX0, int localY0, TileBlock& block);
+        void UpdateQuadIndices(uint32_t quadCount);
+
+        // Bake inputs, kept for RebakeTile
+        const std::vector<TileChunk>* m_chunks = nullptr;
+        TileMapOrientation m_orientation = TileMapOrientation::Orthogonal;
+        int m_tileWidth = 0;
+        int m_tileHeight = 0;
+        TileResolver m_resolveTile;
+        TileDepthFunction m_tileDepth;
+
+        std::vector<TileBlock> m_blocks;
+        std::vector<ChunkBlocks> m_chunkBlocks;   // Indexed like the chunk list
+        std::vector<int> m_quadIndices;           // 6 indices per quad, shared by every batch
+        bool m_built = false;
+        uint32_t m_generation = 0;
+    };
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,76 @@
+/*
+ * Olympe Engine V2 - 2025
+ * Tile Projection
+ *
+ * Tile-to-world placement specialized per map orientation at compile time.
+ * Loops over tiles are instantiated once per orientation (see TileGeometry::BakeBlock),
+ * so the orientation is tested once per loop instead of once per tile.
+ */
+
+#pragma once
+
+#include <string>
+
+namespace Olympe {
+namespace Rendering {
+
+    // Map orientation, parsed once instead of compared as a string per tile
+    enum class TileMapOrientation
+    {
+        Orthogonal,
+        Isometric,
+        Hexagonal
+    };
+
+    TileMapOrientation ParseTileMapOrientation(const std::string& orientation);
+
+    template <TileMapOrientation Orientation>
+    struct TileProjection;
+
+    // Grid cells, sorted by row
+    template <>
+    struct TileProjection<TileMapOrientation::Orthogonal>
+    {
+        // Top-left corner of a srcW x srcH tile image at tile (tileX, tileY), before its tileoffset
+        static void QuadOrigin(int tileX, int tileY, int srcW, int srcH, int tileW, int tileH, float& left, float& top)
+        {
+            (void)srcW; (void)srcH;
+            left = static_cast<float>(tileX * tileW);
+            top = static_cast<float>(tileY * tileH);
+        }
+
+        // Depth band: tiles of one band never overlap each other
+        static int DepthBand(int tileX, int tileY) { (void)tileX; return tileY; }
+    };
+
+    // Diamond cells, image centered horizontally and anchored at the cell's bottom, sorted by diagonal
+    template <>
+    struct TileProjection<TileMapOrientation::Isometric>
+    {
+        static void QuadOrigin(int tileX, int tileY, int srcW, int srcH, int tileW, int tileH, float& left, float& top)
+        {
+            left = (tileX - tileY) * (tileW / 2.0f) - srcW / 2.0f;
+            top = (tileX + tileY) * (tileH / 2.0f) - srcH + tileH;
+        }
+
+        static int DepthBand(int tileX, int tileY) { return tileX + tileY; }
+    };
+
+    // Axial hex coordinates (pointy top, radius tileW / 2), sorted by row
+    template <>
+    struct TileProjection<TileMapOrientation::Hexagonal>
+    {
+        static void QuadOrigin(int tileX, int tileY, int srcW, int srcH, int tileW, int tileH, float& left, float& top)
+        {
+            (void)srcW; (void)srcH; (void)tileH;
+            const float sqrt3 = 1.7320508075688772f;
+            const float hexRadius = tileW / 2.0f;
+            left = hexRadius * (sqrt3 * tileX + sqrt3 / 2.0f * tileY);
+            top = hexRadius * (3.0f / 2.0f * tileY);
+        }
+
+        static int DepthBand(int tileX, int tileY) { (void)tileX; return tileY; }
+    };
+
+} // namespace Rendering
+} // namespace Olympe
@@ -0,0 +1,60 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+StringAtom implementation: global intern table.
+
+*/
+
+#include "StringAtom.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    struct AtomTable
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, AtomID> ids;
+        std::deque<std::string> strings; // deque: references stay valid as it grows
+
+        AtomTable()
+        {
+            strings.emplace_back();
+            ids.emplace(std::string(), INVALID_ATOM);
+        }
+    };
+
+    AtomTable& GetAtomTable()
+    {
+        static AtomTable table;
+        return table;
+    }
+}
+
+AtomID InternAtom(const std::string& text)
+{
+    AtomTable& table = GetAtomTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.ids.find(text);
+    if (it != table.ids.end())
+        return it->second;
+
+    const AtomID atom = static_cast<AtomID>(table.strings.size());
+    table.strings.push_back(text);
+    table.ids.emplace(text, atom);
+    return atom;
+}
+
+const std::string& AtomToString(AtomID atom)
+{
+    AtomTable& table = GetAtomTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return (atom < table.strings.size()) ? table.strings[atom] : table.strings[INVALID_ATOM];
+}
@@ -0,0 +1,33 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+StringAtom purpose: Interned strings for entity types and tags.
+Each distinct string is stored once in a global table and identified by a small
+integer, so runtime code compares atoms (one integer compare) instead of strings.
+Interning takes a lock and hashes the string: do it at load/creation time and
+cache the result (e.g. in a function-local static), never per entity per frame.
+
+Usage:
+    static const AtomID s_menuElement = InternAtom("MenuElement");
+    if (identity.tagAtom == s_menuElement) { ... }
+
+*/
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+using AtomID = std::uint32_t;
+
+// Atom of the empty string
+const AtomID INVALID_ATOM = 0;
+
+// Returns the atom of 'text', adding it to the table on first use (thread-safe)
+AtomID InternAtom(const std::string& text);
+
+// Returns the string of an atom (empty string for unknown atoms)
+const std::string& AtomToString(AtomID atom);
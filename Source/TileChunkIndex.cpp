@@ -0,0 +1,127 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+TileChunkIndex implementation: uniform grid build and range query.
+
+*/
+
+#include "TileChunkIndex.h"
+
+#include <algorithm>
+
+int TileChunkIndex::FloorDiv(int value, int divisor)
+{
+    // Chunks of infinite maps have negative coordinates
+    return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+void TileChunkIndex::Clear()
+{
+    m_chunks = nullptr;
+    m_cellsX = 0;
+    m_cellsY = 0;
+    m_cellStart.clear();
+    m_cellChunks.clear();
+}
+
+void TileChunkIndex::Build(const std::vector<TileChunk>& chunks, int cellSize)
+{
+    Clear();
+    m_chunks = &chunks;
+    m_cellSize = (cellSize > 0) ? cellSize : static_cast<int>(DEFAULT_CELL_SIZE);
+
+    bool any = false;
+    int minX = 0, minY = 0, maxX = 0, maxY = 0;
+    for (const TileChunk& chunk : chunks)
+    {
+        if (chunk.width <= 0 || chunk.height <= 0) continue;
+        const int x0 = FloorDiv(chunk.x, m_cellSize);
+        const int y0 = FloorDiv(chunk.y, m_cellSize);
+        const int x1 = FloorDiv(chunk.x + chunk.width - 1, m_cellSize);
+        const int y1 = FloorDiv(chunk.y + chunk.height - 1, m_cellSize);
+        minX = any ? std::min(minX, x0) : x0;
+        minY = any ? std::min(minY, y0) : y0;
+        maxX = any ? std::max(maxX, x1) : x1;
+        maxY = any ? std::max(maxY, y1) : y1;
+        any = true;
+    }
+    if (!any) return;
+
+    m_cellMinX = minX;
+    m_cellMinY = minY;
+    m_cellsX = maxX - minX + 1;
+    m_cellsY = maxY - minY + 1;
+
+    // Two passes (count, then fill) keep every cell's list in one flat array
+    const size_t cellCount = static_cast<size_t>(m_cellsX) * static_cast<size_t>(m_cellsY);
+    m_cellStart.assign(cellCount + 1, 0);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        std::vector<uint32_t> cursor;
+        if (pass == 1)
+        {
+            for (size_t c = 0; c < cellCount; ++c)
+                m_cellStart[c + 1] += m_cellStart[c];
+            m_cellChunks.resize(m_cellStart[cellCount]);
+            cursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+        }
+
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            const TileChunk& chunk = chunks[i];
+            if (chunk.width <= 0 || chunk.height <= 0) continue;
+            const int x0 = FloorDiv(chunk.x, m_cellSize) - m_cellMinX;
+            const int y0 = FloorDiv(chunk.y, m_cellSize) - m_cellMinY;
+            const int x1 = FloorDiv(chunk.x + chunk.width - 1, m_cellSize) - m_cellMinX;
+            const int y1 = FloorDiv(chunk.y + chunk.height - 1, m_cellSize) - m_cellMinY;
+            for (int cy = y0; cy <= y1; ++cy)
+            {
+                for (int cx = x0; cx <= x1; ++cx)
+                {
+                    const size_t cell = static_cast<size_t>(cy) * m_cellsX + cx;
+                    if (pass == 0)
+                        ++m_cellStart[cell + 1];
+                    else
+                        m_cellChunks[cursor[cell]++] = static_cast<uint32_t>(i);
+                }
+            }
+        }
+    }
+}
+
+void TileChunkIndex::CollectChunks(const TileRect& range, std::vector<uint32_t>& outChunks) const
+{
+    outChunks.clear();
+    if (!m_chunks || m_cellsX == 0 || range.IsEmpty()) return;
+
+    const int x0 = std::max(FloorDiv(range.minX, m_cellSize) - m_cellMinX, 0);
+    const int y0 = std::max(FloorDiv(range.minY, m_cellSize) - m_cellMinY, 0);
+    const int x1 = std::min(FloorDiv(range.maxX, m_cellSize) - m_cellMinX, m_cellsX - 1);
+    const int y1 = std::min(FloorDiv(range.maxY, m_cellSize) - m_cellMinY, m_cellsY - 1);
+    if (x0 > x1 || y0 > y1) return;
+
+    for (int cy = y0; cy <= y1; ++cy)
+    {
+        for (int cx = x0; cx <= x1; ++cx)
+        {
+            const size_t cell = static_cast<size_t>(cy) * m_cellsX + cx;
+            for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i)
+            {
+                // Cells are coarser than the range: keep only chunks that really overlap it
+                const TileChunk& chunk = (*m_chunks)[m_cellChunks[i]];
+                if (chunk.x > range.maxX || chunk.x + chunk.width - 1 < range.minX ||
+                    chunk.y > range.maxY || chunk.y + chunk.height - 1 < range.minY)
+                    continue;
+                outChunks.push_back(m_cellChunks[i]);
+            }
+        }
+    }
+
+    // A chunk spanning several cells is listed once per cell; keep chunk list order
+    std::sort(outChunks.begin(), outChunks.end());
+    outChunks.erase(std::unique(outChunks.begin(), outChunks.end()), outChunks.end());
+}
@@ -0,0 +1,123 @@
+/**
+ * @file TileChunkIndex.h
+ * @brief Tile chunk storage and spatial index for tile layer culling
+ * @author Nicolas Chereau
+ * @date 2025
+ *
+ * @details
+ * TileChunkIndex buckets the tile chunks of the loaded map into a uniform grid of
+ * cells (in tile coordinates). A visibility query only looks at the cells overlapping
+ * the visible tile range, rejects whole chunks outside it, and hands back the
+ * intersecting sub-rectangle of each visible chunk, so per-camera tile culling costs
+ * O(visible tiles) instead of O(map tiles).
+ *
+ * Usage:
+ *     index.Query(visibleRange, [](const TileChunk& chunk, const TileRect& local) {
+ *         for (int y = local.minY; y <= local.maxY; ++y)
+ *             for (int x = local.minX; x <= local.maxX; ++x) { ... }
+ *     });
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct TileChunk
+ * @brief Represents a chunk of tiles for rendering
+ *
+ * Tile chunks are used to batch tile rendering for performance.
+ * Each chunk contains a grid of tiles from a single layer.
+ */
+struct TileChunk
+{
+    std::string layerName;       ///< Name of the source layer
+    int x;                       ///< Chunk X position (in tiles)
+    int y;                       ///< Chunk Y position (in tiles)
+    int width;                   ///< Chunk width (in tiles)
+    int height;                  ///< Chunk height (in tiles)
+    int zOrder;                  ///< Render order (Z-coordinate)
+    std::vector<uint32_t> tileGIDs;  ///< Tile Global IDs (with flip flags)
+
+    /** @brief Default constructor */
+    TileChunk() : x(0), y(0), width(0), height(0), zOrder(0) {}
+};
+
+/**
+ * @struct TileRect
+ * @brief Inclusive rectangle of tile coordinates
+ */
+struct TileRect
+{
+    int minX = 0;
+    int minY = 0;
+    int maxX = -1;
+    int maxY = -1;
+
+    bool IsEmpty() const { return maxX < minX || maxY < minY; }
+};
+
+/**
+ * @class TileChunkIndex
+ * @brief Uniform grid over tile chunks for view culling
+ */
+class TileChunkIndex
+{
+public:
+    /// Default cell size in tiles (Tiled infinite maps use 16x16 chunks)
+    static const int DEFAULT_CELL_SIZE = 32;
+
+    /**
+     * @brief Rebuild the grid from the chunk list
+     * @param chunks Chunks to index (must outlive the index or the next Build)
+     * @param cellSize Cell size in tiles
+     */
+    void Build(const std::vector<TileChunk>& chunks, int cellSize = DEFAULT_CELL_SIZE);
+
+    /** @brief Drop every chunk */
+    void Clear();
+
+    /// Number of chunks indexed by the last Build
+    size_t GetChunkCount() const { return m_chunks ? m_chunks->size() : 0; }
+
+    /**
+     * @brief Collect the indices of the chunks overlapping 'range', in chunk list order
+     * @param range Visible tile range (inclusive, world tile coordinates)
+     * @param outChunks Receives chunk indices (cleared first)
+     */
+    void CollectChunks(const TileRect& range, std::vector<uint32_t>& outChunks) const;
+
+    /**
+     * @brief Call fn(const TileChunk&, const TileRect& local) for every chunk overlapping
+     * 'range', with 'local' the intersecting rows/columns in chunk coordinates (inclusive)
+     */
+    template <typename Fn>
+    void Query(const TileRect& range, Fn&& fn) const
+    {
+        std::vector<uint32_t> candidates;
+        CollectChunks(range, candidates);
+        for (uint32_t chunkIndex : candidates)
+        {
+            const TileChunk& chunk = (*m_chunks)[chunkIndex];
+            TileRect local;
+            local.minX = (range.minX > chunk.x ? range.minX : chunk.x) - chunk.x;
+            local.minY = (range.minY > chunk.y ? range.minY : chunk.y) - chunk.y;
+            local.maxX = (range.maxX < chunk.x + chunk.width - 1 ? range.maxX : chunk.x + chunk.width - 1) - chunk.x;
+            local.maxY = (range.maxY < chunk.y + chunk.height - 1 ? range.maxY : chunk.y + chunk.height - 1) - chunk.y;
+            fn(chunk, local);
+        }
+    }
+
+private:
+    static int FloorDiv(int value, int divisor);
+
+    const std::vector<TileChunk>* m_chunks = nullptr;
+    int m_cellSize = DEFAULT_CELL_SIZE;
+    int m_cellMinX = 0;               ///< Grid origin (in cells)
+    int m_cellMinY = 0;
+    int m_cellsX = 0;                 ///< Grid size (in cells)
+    int m_cellsY = 0;
+    std::vector<uint32_t> m_cellStart;    ///< Per-cell offset into m_cellChunks (size cells + 1)
+    std::vector<uint32_t> m_cellChunks;   ///< Chunk indices, grouped by cell, ascending in each cell
+};
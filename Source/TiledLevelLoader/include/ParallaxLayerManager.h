@@ -76,7 +76,11 @@ namespace Tiled {
             // Get layer by index
             const ParallaxLayer* GetLayer(size_t index) const;
 
-            // Render a specific layer
+            // False when the layer cannot cover any pixel of the camera's viewport
+            // (hidden, transparent, or scrolled out of view on a non-repeating axis)
+            bool IsLayerVisible(const ParallaxLayer& layer, const CameraTransform& cam) const;
+
+            // Render a specific layer: every repetition in one SDL_RenderGeometry call
             void RenderLayer(const ParallaxLayer& layer, const CameraTransform& cam) const;
 
             // Render all layers in z-order
@@ -90,6 +94,14 @@ namespace Tiled {
             ParallaxLayerManager& operator=(const ParallaxLayerManager&) = delete;
 
             vector<ParallaxLayer> layers_;
+
+        private:
+            // Unrotated screen rect of the layer image (viewport-local, zoom applied)
+            bool GetLayerScreenRect(const ParallaxLayer& layer, const CameraTransform& cam, SDL_FRect& outRect) const;
+
+            // Scratch geometry of RenderLayer (layers are drawn on the render thread only)
+            mutable vector<SDL_Vertex> vertices_;
+            mutable vector<int> indices_;
         };
 
 } // namespace Tiled
@@ -83,12 +83,9 @@ namespace Tiled {
         return &layers_[index];
     }
 
-    void ParallaxLayerManager::RenderLayer(const ParallaxLayer& layer, const CameraTransform& cam) const
+    bool ParallaxLayerManager::GetLayerScreenRect(const ParallaxLayer& layer, const CameraTransform& cam, SDL_FRect& outRect) const
     {
-        if (!layer.visible || !layer.texture) return;
-
-        SDL_Renderer* renderer = GameEngine::renderer;
-        if (!renderer) return;
+        if (!layer.texture) return false;
 
         float texW, texH;
         SDL_GetTextureSize(layer.texture, &texW, &texH);
@@ -98,71 +95,138 @@ namespace Tiled {
         float worldY = layer.offsetY - (cam.worldPosition.y * layer.scrollFactorY);
         
         // Calculate screen position with zoom only (no rotation)
-        // Rotation is applied separately via SDL_RenderTextureRotated with viewport-centered pivot
-        float screenX = worldX * cam.zoom - cam.screenOffset.x + cam.viewport.w / 2.0f;
-        float screenY = worldY * cam.zoom - cam.screenOffset.y + cam.viewport.h / 2.0f;
+        // Rotation is applied to the vertices around the viewport center
+        outRect.x = worldX * cam.zoom - cam.screenOffset.x + cam.viewport.w / 2.0f;
+        outRect.y = worldY * cam.zoom - cam.screenOffset.y + cam.viewport.h / 2.0f;
         
         // Apply zoom to dimensions
-        texW *= cam.zoom;
-        texH *= cam.zoom;
+        outRect.w = texW * cam.zoom;
+        outRect.h = texH * cam.zoom;
+        return outRect.w > 0.0f && outRect.h > 0.0f;
+    }
 
-        SDL_SetTextureAlphaMod(layer.texture, static_cast<Uint8>(layer.opacity * 255));
+    bool ParallaxLayerManager::IsLayerVisible(const ParallaxLayer& layer, const CameraTransform& cam) const
+    {
+        if (!layer.visible || layer.opacity <= 0.0f) return false;
 
-        int screenW = (int)cam.viewport.w;
-        int screenH = (int)cam.viewport.h;
+        SDL_FRect rect;
+        if (!GetLayerScreenRect(layer, cam, rect)) return false;
 
-        if (layer.repeatX || layer.repeatY)
+        if (cam.rotation != 0.0f)
         {
-            // Tiled rendering with zoom-aware calculations
-            float tileOffsetX = layer.repeatX ? fmod(screenX, texW) : screenX;
-            float tileOffsetY = layer.repeatY ? fmod(screenY, texH) : screenY;
-            
-            // Adjust for negative values
-            if (tileOffsetX > 0) tileOffsetX -= texW;
-            if (tileOffsetY > 0) tileOffsetY -= texH;
-            
-            // Calculate number of tiles needed (using zoomed dimensions)
-            int tilesX = layer.repeatX ? (int)ceil(screenW / texW) + 2 : 1;
-            int tilesY = layer.repeatY ? (int)ceil(screenH / texH) + 2 : 1;
-            
-            // Render each tile WITH rotation around viewport center
-            for (int tileY = 0; tileY < tilesY; ++tileY)
+            // A rotated repeating strip is kept (conservative)
+            if (layer.repeatX || layer.repeatY) return true;
+
+            // Bounding box of the image rotated around the viewport center
+            const float centerX = cam.viewport.w / 2.0f;
+            const float centerY = cam.viewport.h / 2.0f;
+            const Olympe::Rendering::Affine2D rotate = Olympe::Rendering::Affine2D::Translate(centerX, centerY)
+                * Olympe::Rendering::Affine2D::RotateScale(cam.rotation, 1.0f)
+                * Olympe::Rendering::Affine2D::Translate(-centerX, -centerY);
+            const float cornersX[4] = { rect.x, rect.x + rect.w, rect.x, rect.x + rect.w };
+            const float cornersY[4] = { rect.y, rect.y, rect.y + rect.h, rect.y + rect.h };
+            float minX = rotate.ApplyX(cornersX[0], cornersY[0]), maxX = minX;
+            float minY = rotate.ApplyY(cornersX[0], cornersY[0]), maxY = minY;
+            for (int i = 1; i < 4; ++i)
             {
-                for (int tileX = 0; tileX < tilesX; ++tileX)
+                const float x = rotate.ApplyX(cornersX[i], cornersY[i]);
+                const float y = rotate.ApplyY(cornersX[i], cornersY[i]);
+                minX = std::min(minX, x); maxX = std::max(maxX, x);
+                minY = std::min(minY, y); maxY = std::max(maxY, y);
+            }
+            return !(maxX < 0.0f || minX > cam.viewport.w || maxY < 0.0f || minY > cam.viewport.h);
+        }
+
+        // A repeating axis always covers the viewport
+        const bool visibleX = layer.repeatX || !(rect.x + rect.w < 0.0f || rect.x > cam.viewport.w);
+        const bool visibleY = layer.repeatY || !(rect.y + rect.h < 0.0f || rect.y > cam.viewport.h);
+        return visibleX && visibleY;
+    }
+
+    void ParallaxLayerManager::RenderLayer(const ParallaxLayer& layer, const CameraTransform& cam) const
+    {
+        if (!layer.visible || !layer.texture) return;
+
+        SDL_Renderer* renderer = GameEngine::renderer;
+        if (!renderer) return;
+
+        SDL_FRect rect;
+        if (!GetLayerScreenRect(layer, cam, rect)) return;
+        const float texW = rect.w;
+        const float texH = rect.h;
+
+        const float screenW = cam.viewport.w;
+        const float screenH = cam.viewport.h;
+
+        // Tiled rendering with zoom-aware calculations
+        float tileOffsetX = layer.repeatX ? fmod(rect.x, texW) : rect.x;
+        float tileOffsetY = layer.repeatY ? fmod(rect.y, texH) : rect.y;
+        
+        // Adjust for negative values
+        if (layer.repeatX && tileOffsetX > 0) tileOffsetX -= texW;
+        if (layer.repeatY && tileOffsetY > 0) tileOffsetY -= texH;
+        
+        // Calculate number of tiles needed (using zoomed dimensions)
+        const int tilesX = layer.repeatX ? (int)ceil(screenW / texW) + 2 : 1;
+        const int tilesY = layer.repeatY ? (int)ceil(screenH / texH) + 2 : 1;
+
+        // Every tile rotates around the viewport center (not its own center),
+        // as SDL_RenderTextureRotated with a viewport-centered pivot did
+        const bool rotated = cam.rotation != 0.0f;
+        const float centerX = screenW / 2.0f;
+        const float centerY = screenH / 2.0f;
+        const Olympe::Rendering::Affine2D rotate = Olympe::Rendering::Affine2D::Translate(centerX, centerY)
+            * Olympe::Rendering::Affine2D::RotateScale(cam.rotation, 1.0f)
+            * Olympe::Rendering::Affine2D::Translate(-centerX, -centerY);
+
+        // SDL_RenderGeometry ignores the texture alpha mod: the opacity goes in the vertex color
+        const SDL_FColor color = { 1.0f, 1.0f, 1.0f, layer.opacity };
+        const float us[4] = { 0.0f, 1.0f, 0.0f, 1.0f };
+        const float vs[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+        vertices_.clear();
+        for (int tileY = 0; tileY < tilesY; ++tileY)
+        {
+            for (int tileX = 0; tileX < tilesX; ++tileX)
+            {
+                const float left = tileOffsetX + tileX * texW;
+                const float top = tileOffsetY + tileY * texH;
+                // Unrotated tiles outside the viewport are dropped
+                if (!rotated && (left + texW < 0.0f || left > screenW || top + texH < 0.0f || top > screenH))
+                    continue;
+
+                const float cornersX[4] = { left, left + texW, left, left + texW };
+                const float cornersY[4] = { top, top, top + texH, top + texH };
+                for (int i = 0; i < 4; ++i)
                 {
-                    SDL_FRect destRect = {
-                        tileOffsetX + tileX * texW,
-                        tileOffsetY + tileY * texH,
-                        texW,
-                        texH
-                    };
-                    
-                    // Pivot = viewport center in tile's coordinate space
-                    // This makes the tile rotate around the camera center (not its own center)
-                    SDL_FPoint pivotInTileSpace = {
-                        cam.viewport.w / 2.0f - destRect.x,
-                        cam.viewport.h / 2.0f - destRect.y
-                    };
-                    
-                    SDL_RenderTextureRotated(renderer, layer.texture, nullptr, &destRect,
-                                            cam.rotation, &pivotInTileSpace, SDL_FLIP_NONE);
+                    SDL_Vertex vertex;
+                    vertex.position.x = rotate.ApplyX(cornersX[i], cornersY[i]);
+                    vertex.position.y = rotate.ApplyY(cornersX[i], cornersY[i]);
+                    vertex.color = color;
+                    vertex.tex_coord.x = us[i];
+                    vertex.tex_coord.y = vs[i];
+                    vertices_.push_back(vertex);
                 }
             }
         }
-        else
+        if (vertices_.empty()) return;
+
+        // Shared index pattern (0,1,2 / 2,1,3 per quad), extended to the largest layer
+        const size_t quadCount = vertices_.size() / 4;
+        const size_t current = indices_.size() / 6;
+        if (quadCount > current)
         {
-            // Single image with zoom
-            SDL_FRect destRect = {screenX, screenY, texW, texH};
-            
-            // Rotate around viewport center
-            SDL_FPoint pivotInTileSpace = {
-                cam.viewport.w / 2.0f - destRect.x,
-                cam.viewport.h / 2.0f - destRect.y
-            };
-            
-            SDL_RenderTextureRotated(renderer, layer.texture, nullptr, &destRect,
-                                    cam.rotation, &pivotInTileSpace, SDL_FLIP_NONE);
+            indices_.resize(quadCount * 6);
+            for (size_t q = current; q < quadCount; ++q)
+            {
+                const int v = static_cast<int>(q * 4);
+                int* idx = &indices_[q * 6];
+                idx[0] = v + 0; idx[1] = v + 1; idx[2] = v + 2;
+                idx[3] = v + 2; idx[4] = v + 1; idx[5] = v + 3;
+            }
         }
+
+        SDL_RenderGeometry(renderer, layer.texture, vertices_.data(), static_cast<int>(vertices_.size()),
+                           indices_.data(), static_cast<int>(quadCount * 6));
     }
 
     void ParallaxLayerManager::RenderAllLayers(const CameraTransform& cam) const
@@ -16,6 +16,7 @@ World purpose: Manage the lifecycle of Entities and their interaction with ECS S
 #include "OlympeTilemapEditor/include/LevelManager.h"
 #include "ECS_Systems_AI.h"
 #include "ECS_Systems_Animation.h"
+#include "ECS_Systems_Collision.h"
 #include "Animation/AnimationManager.h"
 #include "BlueprintEditor/WorldBridge.h"
 #include "OlympeTilemapEditor/include/LevelManager.h"
@@ -82,6 +83,9 @@ void LogCreatedEntityDetails(EntityID entity)
 //---------------------------------------------------------------------------------------------
 World::World()
 {
+    // Reserve slot 0 so that INVALID_ENTITY_ID never maps to a live entity
+    m_entitySlots.emplace_back();
+
     Initialize_ECS_Systems();
 
     m_mapOrientation = "orthogonal"; 
@@ -90,9 +94,8 @@ World::World()
 
     // Auto-create singleton GridSettings entity if missing
     bool hasGridSettings = false;
-    for (const auto& kv : m_entitySignatures)
+    for (EntityID e : m_entities)
     {
-        EntityID e = kv.first;
         if (HasComponent<GridSettings_data>(e))
         {
             hasGridSettings = true;
@@ -186,15 +189,14 @@ void World::Add_ECS_System(std::unique_ptr<ECS_System> system)
 {
     // Enregistrement d'un syst�me
     m_systems.push_back(std::move(system));
+    m_scheduler.Invalidate();
 }
 //---------------------------------------------------------------------------------------------
 void World::Process_ECS_Systems()
 {
-	// update all registered systems in order
-    for (const auto& system : m_systems)
-    {
-        system->Process();
-    }
+	// Update all registered systems: non-conflicting systems run in parallel,
+	// conflicting ones keep their registration order (see ECS_Scheduler.h)
+    m_scheduler.Run(m_systems);
 }
 //---------------------------------------------------------------------------------------------
 void World::Render_ECS_Systems()
@@ -218,13 +220,13 @@ void World::RenderDebug_ECS_Systems()
     }
 }
 //---------------------------------------------------------------------------------------------
-void World::Notify_ECS_Systems(EntityID entity, ComponentSignature signature)
+void World::Notify_ECS_Systems(EntityID entity, const ComponentSignature& signature)
 {
     // V�rifie si l'Entit� correspond maintenant aux exigences d'un Syst�me
     for (const auto& system : m_systems)
     {
         // Utilisation de l'op�ration de bits AND pour la comparaison (tr�s rapide)
-        if ((signature & system->requiredSignature) == system->requiredSignature)
+        if (signature.Contains(system->requiredSignature) && !signature.Intersects(system->excludedSignature))
         {
             // L'Entit� correspond : l'ajouter au Syst�me
             system->AddEntity(entity);
@@ -235,33 +237,64 @@ void World::Notify_ECS_Systems(EntityID entity, ComponentSignature signature)
             system->RemoveEntity(entity);
         }
     }
+
+    // Keep cached views in sync (same incremental rule as systems)
+    for (const CachedView& view : m_viewCache)
+    {
+        if (signature.Contains(view.signature))
+            view.entities->insert(entity);
+        else
+            view.entities->erase(entity);
+    }
 }
 //---------------------------------------------------------------------------------------------
-EntityID World::CreateEntity()
+const EntitySet& World::GetCachedView(const ComponentSignature& signature)
 {
-    // --- UID Generation based on nanosecond timestamp ---
-    using namespace std::chrono;
+    for (const CachedView& view : m_viewCache)
+    {
+        if (view.signature == signature)
+            return *view.entities;
+    }
 
-    // 1. Generate a unique ID (UID) based on current time in nanoseconds
-    // This provides a globally unique ID suitable for serialization and persistence.
-    auto now = system_clock::now();
-    EntityID newID = static_cast<std::uint64_t>(duration_cast<nanoseconds>(now.time_since_epoch()).count());
+    // First request for this signature: build the set once from the live entities
+    CachedView view;
+    view.signature = signature;
+    view.entities.reset(new EntitySet());
+    for (EntityID entity : m_entities)
+    {
+        const ComponentSignature& entitySignature = m_entitySlots[GetEntityIndex(entity)].signature;
+        if (entitySignature.Contains(signature))
+            view.entities->insert(entity);
+    }
 
-    // Check for potential collision (extremely rare but possible if two entities are created
-    // in the exact same nanosecond or during deserialization without proper synchronization)
-    while (m_entitySignatures.count(newID))
+    m_viewCache.push_back(std::move(view));
+    return *m_viewCache.back().entities;
+}
+//---------------------------------------------------------------------------------------------
+EntityID World::CreateEntity()
+{
+    // Recycles a free slot first; its generation was bumped when it was released
+    const EntityID newID = m_entityHandles.Allocate();
+    if (newID == INVALID_ENTITY_ID)
     {
-        // If collision occurs (two entities created in the same nanosecond), increment the ID.
-        // This is a simple conflict resolution mechanism.
-        newID++;
+        SYSTEM_LOG << "World::CreateEntity: entity index space exhausted ("
+                   << ENTITY_INDEX_MASK << " entities)\n";
+        return INVALID_ENTITY_ID;
     }
+
+    const std::uint32_t index = GetEntityIndex(newID);
+    if (index >= m_entitySlots.size())
+        m_entitySlots.resize(index + 1);
+
     // Initialize the Entity's signature as empty
-    m_entitySignatures[newID] = ComponentSignature{};
-    
+    EntitySlot& slot = m_entitySlots[index];
+    slot.signature.reset();
+
     // Notify Blueprint Editor (if active)
     NotifyBlueprintEditorEntityCreated(newID);
 
     // Add to entity list
+    slot.denseIndex = static_cast<std::uint32_t>(m_entities.size());
     m_entities.push_back(newID);
     
     return newID;
@@ -269,7 +302,7 @@ EntityID World::CreateEntity()
 //---------------------------------------------------------------------------------------------
 void World::DestroyEntity(EntityID entity)
 {
-    if (entity == INVALID_ENTITY_ID || m_entitySignatures.find(entity) == m_entitySignatures.end())
+    if (!IsEntityValid(entity))
     {
         return;
     }
@@ -278,14 +311,14 @@ void World::DestroyEntity(EntityID entity)
     NotifyBlueprintEditorEntityDestroyed(entity);
 
     // 1. Supprimer les composants de tous les Pools o� l'Entit� existe
-    ComponentSignature signature = m_entitySignatures[entity];
-    for (const auto& pair : m_componentPools)
+    const std::uint32_t index = GetEntityIndex(entity);
+    ComponentSignature signature = m_entitySlots[index].signature;
+    for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENTS; ++typeID)
     {
-        ComponentTypeID typeID = pair.first;
-        if (signature.test(typeID))
+        if (signature.test(typeID) && m_componentPools[typeID])
         {
             // Utilise la m�thode virtuelle RemoveComponent (Phase 1.2)
-            pair.second->RemoveComponent(entity);
+            m_componentPools[typeID]->RemoveComponent(entity);
         }
     }
 
@@ -293,13 +326,64 @@ void World::DestroyEntity(EntityID entity)
     Notify_ECS_Systems(entity, ComponentSignature{}); // Signature vide pour forcer la suppression
 
     // 3. Nettoyer les maps
-    m_entitySignatures.erase(entity);
+    EntitySlot& slot = m_entitySlots[index];
+    slot.signature.reset();
+
+    // Swap-remove from the packed entity list
+    const std::uint32_t denseIndex = slot.denseIndex;
+    const EntityID movedEntity = m_entities.back();
+    m_entities[denseIndex] = movedEntity;
+    m_entitySlots[GetEntityIndex(movedEntity)].denseIndex = denseIndex;
+    m_entities.pop_back();
+
+    // 4. Recycler l'ID: generation bumped, or slot retired once its generations are exhausted
+    m_entityHandles.Release(entity);
+}
+//---------------------------------------------------------------------------------------------
+void World::DestroyEntities(const std::vector<EntityID>& entities)
+{
+    // Each destroy is O(components of the entity + systems), so a batch is linear in its size
+    for (EntityID entity : entities)
+    {
+        DestroyEntity(entity);
+    }
+}
+//---------------------------------------------------------------------------------------------
+void World::FlushCommandBuffer()
+{
+    if (m_commandBuffer.empty())
+        return;
+
+    // Swap out the recorded commands so callbacks may record new ones for the next flush
+    std::vector<EntityCommandBuffer::CreateCallback> creates;
+    std::vector<EntityID> destroys;
+    m_commandBuffer.TakeCommands(creates, destroys);
 
-	m_entities.erase(std::remove(m_entities.begin(), m_entities.end(), entity), m_entities.end());
+    for (const EntityCommandBuffer::CreateCallback& onCreated : creates)
+    {
+        EntityID entity = CreateEntity();
+        if (entity != INVALID_ENTITY_ID && onCreated)
+            onCreated(entity);
+    }
 
-    // 4. Recycler l'ID (gestion de l'information)
-    m_freeEntityIDs.push(entity);
-    std::cout << "Entit� " << entity << " d�truite et ID recycl�.\n";
+    DestroyEntities(destroys);
+}
+//---------------------------------------------------------------------------------------------
+void World::RefreshIdentity(EntityID entity)
+{
+    Identity_data* identity = IsEntityValid(entity) ? GetOrCreatePool<Identity_data>()->TryGetComponent(entity) : nullptr;
+    if (!identity)
+        return;
+
+    identity->SyncAtoms();
+
+    // UI entities carry a tag component so render systems filter them by signature
+    static const AtomID s_uiElementAtom = InternAtom("UIElement");
+    const bool isUIElement = (identity->typeAtom == s_uiElementAtom);
+    if (isUIElement && !HasComponent<UIElement_data>(entity))
+        AddComponent<UIElement_data>(entity);
+    else if (!isUIElement && HasComponent<UIElement_data>(entity))
+        RemoveComponent<UIElement_data>(entity);
 }
 //---------------------------------------------------------------------------------------------
 // Layer Management Implementation
@@ -380,9 +464,8 @@ void World::SyncGridWithLevel(const Olympe::Editor::LevelDefinition& levelDef)
 {
     // Find GridSettings entity
     bool foundGridSettings = false;
-    for (const auto& kv : m_entitySignatures)
+    for (EntityID e : m_entities)
     {
-        EntityID e = kv.first;
         if (HasComponent<GridSettings_data>(e))
         {
             foundGridSettings = true;
@@ -1422,15 +1505,16 @@ void World::UnloadCurrentLevel()
     
     // Clear tile chunks and tilesets
     m_tileChunks.clear();
+    m_tileChunkIndexDirty = true;
+    m_tileGeometry.Invalidate();
+    m_tileBlockCache.Clear();
     m_tilesetManager.Clear();
-	m_entities.clear();
     
     // Destroy all entities except system entities (like GridSettings)
     std::vector<EntityID> entitiesToDestroy;
     
-    for (const auto& kv : m_entitySignatures)
+    for (EntityID e : m_entities)
     {
-        EntityID e = kv.first;
         
         // Keep system entities (GridSettings, Camera settings, etc.)
         if (HasComponent<GridSettings_data>(e))
@@ -1462,10 +1546,7 @@ void World::UnloadCurrentLevel()
     }
     
     // Destroy marked entities
-    for (EntityID e : entitiesToDestroy)
-    {
-        DestroyEntity(e);
-    }
+    DestroyEntities(entitiesToDestroy);
     
     SYSTEM_LOG << "World::UnloadCurrentLevel - Destroyed " << entitiesToDestroy.size() 
                << " entities\n";
@@ -1606,6 +1687,7 @@ bool World::InstantiatePass1_VisualLayers(
 {
     // Extract map orientation and tile size from metadata
     m_mapOrientation = levelDef.metadata.customData.value("orientation", "orthogonal");
+    m_mapOrientationType = Olympe::Rendering::ParseTileMapOrientation(m_mapOrientation);
     m_tileWidth = levelDef.metadata.customData.value("tilewidth", 32);
     m_tileHeight = levelDef.metadata.customData.value("tileheight", 32);
     
@@ -1847,6 +1929,8 @@ void World::LoadTileChunk(const nlohmann::json& chunkJson, const std::string& la
     chunk.tileGIDs = tileGIDs;
     
     m_tileChunks.push_back(chunk);
+    m_tileChunkIndexDirty = true;
+    m_tileGeometry.Invalidate();
     
     std::cout << "    ok - Loaded chunk at (" << chunkX << ", " << chunkY 
               << ") - " << tileGIDs.size() << " tiles\n";
@@ -1889,6 +1973,30 @@ void World::LoadTileData(const nlohmann::json& dataJson, const std::string& laye
     chunk.tileGIDs = tileGIDs;
     
     m_tileChunks.push_back(chunk);
+    m_tileChunkIndexDirty = true;
+    m_tileGeometry.Invalidate();
+}
+
+bool World::SetTileGID(const std::string& layerName, int worldX, int worldY, uint32_t gid)
+{
+    for (size_t i = 0; i < m_tileChunks.size(); ++i)
+    {
+        TileChunk& chunk = m_tileChunks[i];
+        const int localX = worldX - chunk.x;
+        const int localY = worldY - chunk.y;
+        if (chunk.layerName != layerName || localX < 0 || localY < 0 || localX >= chunk.width || localY >= chunk.height)
+            continue;
+        
+        const size_t tileIndex = static_cast<size_t>(localY) * chunk.width + localX;
+        if (tileIndex >= chunk.tileGIDs.size())
+            return false;
+        
+        chunk.tileGIDs[tileIndex] = gid;
+        // New block revision: cached textures of the block are dropped on next draw
+        m_tileGeometry.RebakeTile(i, localX, localY);
+        return true;
+    }
+    return false;
 }
 
 // ========================================================================
@@ -1918,6 +2026,7 @@ void TilesetManager::Clear()
     }
     
     m_tilesets.clear();
+    m_gidTable.clear();
 }
 
 void TilesetManager::LoadTilesets(const nlohmann::json& tilesetsJson)
@@ -2261,20 +2370,54 @@ void TilesetManager::LoadTilesets(const nlohmann::json& tilesetsJson)
     {
         SYSTEM_LOG << "  [OK] No GID range overlaps detected\n";
     }
+    
+    BuildGidTable();
     SYSTEM_LOG << "[TilesetManager] ========================================+\n";
 }
 
-bool TilesetManager::GetTileTexture(uint32_t gid, SDL_Texture*& outTexture, SDL_Rect& outSrcRect, const TilesetInfo*& outTileset)
+void TilesetManager::BuildGidTable()
 {
-    // Strip flip flags (top 3 bits)
-    uint32_t cleanGid = gid & 0x1FFFFFFF;
+    m_gidTable.clear();
+    
+    uint32_t maxGid = 0;
+    for (const auto& tileset : m_tilesets)
+    {
+        maxGid = std::max(maxGid, tileset.lastgid);
+    }
+    if (m_tilesets.empty()) return;
     
-    if (cleanGid == 0)
+    if (maxGid >= MAX_GID_TABLE_SIZE)
     {
-        outTileset = nullptr;
-        return false;  // Empty tile
+        SYSTEM_LOG << "  [WARNING] GIDs above " << static_cast<uint32_t>(MAX_GID_TABLE_SIZE)
+                  << " are resolved without the lookup table (max GID " << maxGid << ")\n";
+        maxGid = MAX_GID_TABLE_SIZE - 1;
     }
     
+    // Resolve every GID once: overlaps, collection maps and atlas rects are
+    // settled here instead of per visible tile
+    m_gidTable.resize(static_cast<size_t>(maxGid) + 1);
+    uint32_t unresolved = 0;
+    for (uint32_t gid = 1; gid <= maxGid; ++gid)
+    {
+        if (!ResolveTile(gid, m_gidTable[gid]) && m_gidTable[gid].tileset)
+        {
+            ++unresolved;
+        }
+    }
+    
+    SYSTEM_LOG << "  [OK] GID lookup table: " << m_gidTable.size() << " entries";
+    if (unresolved > 0)
+    {
+        SYSTEM_LOG << " (" << unresolved << " GIDs without texture)";
+    }
+    SYSTEM_LOG << "\n";
+}
+
+bool TilesetManager::ResolveTile(uint32_t cleanGid, TileLookup& outLookup) const
+{
+    outLookup = TileLookup();
+    if (cleanGid == 0) return false;  // Empty tile
+    
     // ====================================================================
     // Find the tileset with the HIGHEST firstgid that contains this GID.
     // This ensures we get the most specific tileset when ranges overlap.
@@ -2295,72 +2438,67 @@ bool TilesetManager::GetTileTexture(uint32_t gid, SDL_Texture*& outTexture, SDL_
         }
     }
     
-    if (bestMatch)
+    if (!bestMatch) return false;
+    
+    const TilesetInfo& tileset = *bestMatch;
+    uint32_t localId = cleanGid - tileset.firstgid;
+    outLookup.tileset = bestMatch;
+    
+    if (tileset.isCollection)
     {
-        const TilesetInfo& tileset = *bestMatch;
-        uint32_t localId = cleanGid - tileset.firstgid;
-        
-        // -> CRITICAL: Set the tileset pointer BEFORE any return
-        outTileset = bestMatch;
-        
-        if (tileset.isCollection)
+        // Collection tileset - lookup individual tile
+        auto it = tileset.individualTiles.find(localId);
+        auto srcIt = tileset.individualSrcRects.find(localId);
+        if (it == tileset.individualTiles.end() || srcIt == tileset.individualSrcRects.end() || !it->second)
         {
-            // Collection tileset - lookup individual tile
-            auto it = tileset.individualTiles.find(localId);
-            if (it != tileset.individualTiles.end())
-            {
-                auto srcIt = tileset.individualSrcRects.find(localId);
-                if (srcIt != tileset.individualSrcRects.end())
-                {
-                    outTexture = it->second;
-                    outSrcRect = srcIt->second;
-                    
-                    if (outTexture == nullptr)
-                    {
-                        SDL_LogError(SDL_LOG_CATEGORY_RENDER, 
-                            "[TILESET] NULL texture for collection tile GID=%u, localId=%u", gid, localId);
-                        return false;
-                    }
-                    
-                    return true;
-                }
-            }
-            
-            // Collection tile not found
-            SDL_LogError(SDL_LOG_CATEGORY_RENDER, 
-                "[TILESET] Collection tile not found: GID=%u, localId=%u", gid, localId);
             return false;
         }
-        else
-        {
-            // Image-based tileset - calculate source rect
-            if (!tileset.texture)
-            {
-                SDL_LogError(SDL_LOG_CATEGORY_RENDER, 
-                    "[TILESET] NULL texture for tileset '%s' (GID=%u)", tileset.name.c_str(), gid);
-                return false;
-            }
-            
-            outTexture = tileset.texture;
-            
-            // Calculate source rect with margin and spacing
-            int col = localId % tileset.columns;
-            int row = localId / tileset.columns;
-            
-            outSrcRect.x = tileset.margin + col * (tileset.tilewidth + tileset.spacing);
-            outSrcRect.y = tileset.margin + row * (tileset.tileheight + tileset.spacing);
-            outSrcRect.w = tileset.tilewidth;
-            outSrcRect.h = tileset.tileheight;
-            
-            return true;
-        }
+        
+        outLookup.texture = it->second;
+        outLookup.srcRect = srcIt->second;
+        return true;
     }
     
-    // GID not found in any tileset
-    SYSTEM_LOG << "[TilesetManager::GetTileTexture] X GID " << cleanGid 
-              << " NOT FOUND in any tileset (total tilesets: " << m_tilesets.size() << ")\n";
-    outTileset = nullptr;
-    return false;
+    // Image-based tileset - calculate source rect
+    if (!tileset.texture || tileset.columns <= 0)
+    {
+        return false;
+    }
+    
+    outLookup.texture = tileset.texture;
+    
+    // Calculate source rect with margin and spacing
+    int col = localId % tileset.columns;
+    int row = localId / tileset.columns;
+    
+    outLookup.srcRect.x = tileset.margin + col * (tileset.tilewidth + tileset.spacing);
+    outLookup.srcRect.y = tileset.margin + row * (tileset.tileheight + tileset.spacing);
+    outLookup.srcRect.w = tileset.tilewidth;
+    outLookup.srcRect.h = tileset.tileheight;
+    return true;
+}
+
+TilesetManager::TileLookup TilesetManager::FindTileSlow(uint32_t cleanGid) const
+{
+    TileLookup lookup;
+    ResolveTile(cleanGid, lookup);
+    return lookup;
+}
+
+bool TilesetManager::GetTileTexture(uint32_t gid, SDL_Texture*& outTexture, SDL_Rect& outSrcRect, const TilesetInfo*& outTileset)
+{
+    // Single read in the GID table built by LoadTilesets (flip flags stripped by FindTile).
+    // Called per visible tile: missing GIDs are reported once at load time, not here.
+    const TileLookup lookup = FindTile(gid);
+    outTileset = lookup.tileset;
+    if (!lookup.texture)
+    {
+        return false;
+    }
+    
+    outTexture = lookup.texture;
+    outSrcRect = lookup.srcRect;
+    return true;
 }
 
 bool World::InstantiatePass2_SpatialStructure(
@@ -2940,7 +3078,7 @@ float World::GetIsometricOriginX() const
     // 
     // NOTE: This caching assumes single-threaded access (typical for game engines).
     // If multi-threaded access is needed, synchronization should be added.
-    if (m_mapOrientation == "isometric")
+    if (m_mapOrientationType == Olympe::Rendering::TileMapOrientation::Isometric)
     {
         // Cache both X and Y values together to avoid inconsistency
         if (!m_isometricOriginCached)
@@ -2963,7 +3101,7 @@ float World::GetIsometricOriginY() const
     // 
     // NOTE: This caching assumes single-threaded access (typical for game engines).
     // If multi-threaded access is needed, synchronization should be added.
-    if (m_mapOrientation == "isometric")
+    if (m_mapOrientationType == Olympe::Rendering::TileMapOrientation::Isometric)
     {
         // Cache both X and Y values together to avoid inconsistency
         if (!m_isometricOriginCached)
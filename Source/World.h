@@ -24,21 +24,29 @@
 
 #include "system/EventQueue.h"
 #include "system/system_utils.h"
+#include <cassert>
 #include <vector>
 #include <memory>
 #include <unordered_map>
 #include <queue>
+#include <mutex>
 #include <deque>
 #include <type_traits>
 
 #include "Level.h"
 #include "GameState.h"
+#include "TileChunkIndex.h"
+#include "Rendering/TileGeometry.h"
+#include "Rendering/TileBlockCache.h"
 
 // Include ECS related headers
 #include "Ecs_Entity.h"
 #include "ECS_Components.h"
 #include "ECS_Systems.h"
 #include "ECS_Register.h" // Include the implementation of ComponentPool
+#include "ECS_View.h"
+#include "ECS_CommandBuffer.h"
+#include "ECS_Scheduler.h"
 #include "PrefabScanner.h"
 #include "PrefabFactory.h"
 
@@ -65,27 +73,6 @@ void LogCreatedEntityDetails(EntityID entity);
 // TILE LAYER SUPPORT
 // ========================================================================
 
-/**
- * @struct TileChunk
- * @brief Represents a chunk of tiles for rendering
- * 
- * Tile chunks are used to batch tile rendering for performance.
- * Each chunk contains a grid of tiles from a single layer.
- */
-struct TileChunk
-{
-    std::string layerName;       ///< Name of the source layer
-    int x;                       ///< Chunk X position (in tiles)
-    int y;                       ///< Chunk Y position (in tiles)
-    int width;                   ///< Chunk width (in tiles)
-    int height;                  ///< Chunk height (in tiles)
-    int zOrder;                  ///< Render order (Z-coordinate)
-    std::vector<uint32_t> tileGIDs;  ///< Tile Global IDs (with flip flags)
-
-    /** @brief Default constructor */
-    TileChunk() : x(0), y(0), width(0), height(0), zOrder(0) {}
-};
-
 /**
  * @class TilesetManager
  * @brief Manages tilesets loaded from Tiled maps
@@ -147,6 +134,25 @@ public:
         }
     };
 
+    /**
+     * @struct TileLookup
+     * @brief Pre-resolved render data of one GID (entry of the flat GID table)
+     *
+     * Overlapping ranges are resolved when the table is built (highest firstgid wins),
+     * so a lookup is a single array read. texture == nullptr means "no drawable tile".
+     */
+    struct TileLookup
+    {
+        SDL_Texture* texture;        ///< Atlas or per-tile texture (nullptr if unresolved)
+        SDL_Rect srcRect;            ///< Source rectangle in the texture
+        const TilesetInfo* tileset;  ///< Owning tileset (offsets), nullptr if no range contains the GID
+
+        TileLookup() : texture(nullptr), srcRect{ 0, 0, 0, 0 }, tileset(nullptr) {}
+    };
+
+    /// GIDs above this are resolved by scanning the tilesets instead of through the table
+    static const uint32_t MAX_GID_TABLE_SIZE = 1u << 20;
+
     /**
      * @brief Clear all loaded tilesets
      */
@@ -167,6 +173,17 @@ public:
      * @return True if tile was found
      */
     bool GetTileTexture(uint32_t gid, SDL_Texture*& outTexture, SDL_Rect& outSrcRect, const TilesetInfo*& outTileset);
+
+    /**
+     * @brief Flat-table lookup of a tile by GID (flip flags are ignored)
+     * @param gid Global tile ID
+     * @return Entry with texture == nullptr if the GID has no drawable tile (never logs)
+     */
+    TileLookup FindTile(uint32_t gid) const
+    {
+        const uint32_t cleanGid = gid & 0x1FFFFFFF;
+        return (cleanGid < m_gidTable.size()) ? m_gidTable[cleanGid] : FindTileSlow(cleanGid);
+    }
     
     /**
      * @brief Get all loaded tilesets
@@ -175,7 +192,15 @@ public:
     const std::vector<TilesetInfo>& GetTilesets() const { return m_tilesets; }
 
 private:
+    /// Rebuild m_gidTable from m_tilesets (after loading)
+    void BuildGidTable();
+
+    /// Resolve a GID by scanning the tilesets (table build and GIDs beyond the table)
+    bool ResolveTile(uint32_t cleanGid, TileLookup& outLookup) const;
+    TileLookup FindTileSlow(uint32_t cleanGid) const;
+
     std::vector<TilesetInfo> m_tilesets;  ///< All loaded tilesets
+    std::vector<TileLookup> m_gidTable;   ///< Render data indexed by GID (entry 0 = empty tile)
 };
 
 /**
@@ -263,6 +288,12 @@ public:
         // This is the single point per frame where write buffer becomes read buffer
         EventQueue::Get().BeginFrame();
 
+        // New change tick: writes made this frame are stamped with it
+        AdvanceChangeTick();
+
+        // Apply structural changes deferred during the previous frame, in bulk
+        FlushCommandBuffer();
+
         // check global game state
         GameState state = GameStateManager::GetState();
         bool paused = (state == GameState::GameState_Paused);
@@ -289,6 +320,7 @@ public:
     // Tiled MapEditor integration
     bool LoadLevelFromTiled(const std::string& tiledMapPath);
     void UpdateDeferredLevelLoading();
+    bool IsDeferredLevelLoadingActive() const { return m_deferredLoadState.active; }
     void UnloadCurrentLevel();
     
     // NEW: Load and prepare all behavior tree dependencies for a level
@@ -405,10 +437,36 @@ public:
     // ECS Entity Management
     EntityID CreateEntity();
     void DestroyEntity(EntityID entity);
+
+    /// Destroy a batch of entities (stale handles and duplicates are skipped)
+    void DestroyEntities(const std::vector<EntityID>& entities);
+
+    /// Deferred create/destroy, safe to use while systems or views are iterating,
+    /// including from parallel systems and ParallelForEach chunks (recording is locked).
+    /// Recorded commands are applied once per frame by FlushCommandBuffer().
+    EntityCommandBuffer& GetCommandBuffer() { return m_commandBuffer; }
+    void FlushCommandBuffer();
+
     bool IsEntityValid(EntityID entity) const
     {
-        return m_entitySignatures.find(entity) != m_entitySignatures.end();
+        // O(1) stale-handle detection: the slot must be alive and still on the same generation
+        return m_entityHandles.IsValid(entity);
 	}
+
+    /**
+     * @brief Get the component signature of an entity
+     * @return Signature of the entity (empty signature for invalid/stale handles)
+     */
+    const ComponentSignature& GetEntitySignature(EntityID entity) const
+    {
+        static const ComponentSignature s_emptySignature;
+        return IsEntityValid(entity) ? m_entitySlots[GetEntityIndex(entity)].signature : s_emptySignature;
+    }
+
+    /// Re-intern the Identity_data tag/type atoms and add/remove the UIElement_data tag.
+    /// Called automatically by AddComponent<Identity_data>; call it again after
+    /// editing identity.type or identity.tag at load time.
+    void RefreshIdentity(EntityID entity);
     /**
      * @brief Get all active entity IDs
      * @return Vector of all entity IDs in the world
@@ -425,24 +483,24 @@ public:
     T& AddComponent(EntityID entity, Args&&... args)
     {
         const ComponentTypeID typeID = GetComponentTypeID_Static<T>();
-
-        // 1. Instantiate the pool if it's the first time we add this type
-        if (m_componentPools.find(typeID) == m_componentPools.end())
+        if (!IsEntityValid(entity))
         {
-            m_componentPools[typeID] = std::make_unique<ComponentPool<T>>();
+            throw std::runtime_error("AddComponent on invalid or destroyed entity.");
         }
 
-        // 2. Get the pool and add the component
-        auto* pool = static_cast<ComponentPool<T>*>(m_componentPools[typeID].get());
+        // 1. Instantiate the pool if it's the first time we add this type
+        ComponentPool<T>* pool = GetOrCreatePool<T>();
 
+        // 2. Add the component to the pool
         // Creation and adding of the component using perfect forwarding
         pool->AddComponent(entity, std::forward<Args>(args)...);
 
         // 3. Update the Entity's Signature
-        m_entitySignatures[entity].set(typeID, true);
+        ComponentSignature& signature = m_entitySlots[GetEntityIndex(entity)].signature;
+        signature.set(typeID, true);
 
         // 4. Notify Systems about the signature change
-        Notify_ECS_Systems(entity, m_entitySignatures[entity]);
+        Notify_ECS_Systems(entity, signature);
 
         // 5. Special handling: Register input entities with InputsManager
         HandleSpecialComponentRegistration<T>(entity);
@@ -454,46 +512,79 @@ public:
     void RemoveComponent(EntityID entity)
     {
         const ComponentTypeID typeID = GetComponentTypeID_Static<T>();
-        if (m_componentPools.find(typeID) == m_componentPools.end()) return;
+        if (!m_componentPools[typeID] || !IsEntityValid(entity)) return;
 
         // 1. Remove from the pool
         m_componentPools[typeID]->RemoveComponent(entity);
 
         // 2. Update the Entity's Signature
-        m_entitySignatures[entity].set(typeID, false);
+        ComponentSignature& signature = m_entitySlots[GetEntityIndex(entity)].signature;
+        signature.set(typeID, false);
 
         // 3. Notify Systems
-        Notify_ECS_Systems(entity, m_entitySignatures[entity]);
+        Notify_ECS_Systems(entity, signature);
     }
 
     template <typename T>
     T& GetComponent(EntityID entity)
     {
-        const ComponentTypeID typeID = GetComponentTypeID_Static<T>();
-        if (m_componentPools.find(typeID) == m_componentPools.end())
+        ComponentPool<T>* pool = GetPool<T>();
+        if (!pool)
         {
             throw std::runtime_error("Component pool not registered.");
         }
-
-        auto* pool = static_cast<ComponentPool<T>*>(m_componentPools[typeID].get());
         return pool->GetComponent(entity);
     }
 
+    // Mutable access: stamps the component's change tick (see ComponentView::Changed)
     template <typename T>
-    bool HasComponent(EntityID entity) const
+    T& Modify(EntityID entity)
     {
-        const ComponentTypeID typeID = GetComponentTypeID_Static<T>();
-
-        // Fast check using the signature
-        if (m_entitySignatures.count(entity) && m_entitySignatures.at(entity).test(typeID))
+        ComponentPool<T>* pool = GetPool<T>();
+        if (!pool)
         {
-            // Delegate the final check to the specific Pool
-            if (m_componentPools.count(typeID)) {
-                auto* pool = static_cast<ComponentPool<T>*>(m_componentPools.at(typeID).get());
-                return pool->HasComponent(entity);
-            }
+            throw std::runtime_error("Component pool not registered.");
         }
-        return false;
+        return pool->Modify(entity);
+    }
+
+    template <typename T>
+    bool HasComponent(EntityID entity) const
+    {
+        // The pool's sparse set is authoritative and answers in O(1)
+        const ComponentPool<T>* pool = GetPool<T>();
+        return pool && pool->HasComponent(entity);
+    }
+
+    /**
+     * @brief Query the entities owning all the given components
+     *
+     * The matching entity list is cached per signature and kept up to date
+     * incrementally by AddComponent/RemoveComponent/DestroyEntity, so calling
+     * View() every frame is cheap.
+     *
+     * @code
+     * World::Get().View<Position_data, Movement_data>().Each(
+     *     [](EntityID e, Position_data& pos, Movement_data& move) { ... });
+     * @endcode
+     */
+    template <typename... Ts>
+    ComponentView<Ts...> View()
+    {
+        ComponentSignature signature;
+        int expand[] = { 0, (signature.set(GetComponentTypeID_Static<Ts>(), true), 0)... };
+        (void)expand;
+
+        // Systems may request views concurrently from the scheduler's worker threads
+        std::lock_guard<std::mutex> lock(m_viewMutex);
+        return ComponentView<Ts...>(GetCachedView(signature), GetOrCreatePool<Ts>()...);
+    }
+
+    /// Direct access to the pool of a component type (nullptr if never added)
+    template <typename T>
+    ComponentPool<T>* GetPool() const
+    {
+        return static_cast<ComponentPool<T>*>(m_componentPools[GetComponentTypeID_Static<T>()].get());
     }
 
     // ========================================================================
@@ -562,9 +653,8 @@ public:
     /// Toggle grid visibility
     void ToggleGrid()
     {
-        for (const auto& kv : m_entitySignatures)
+        for (EntityID e : m_entities)
         {
-            EntityID e = kv.first;
             if (HasComponent<GridSettings_data>(e))
             {
                 GridSettings_data& settings = GetComponent<GridSettings_data>(e);
@@ -580,9 +670,8 @@ public:
     /// Get current grid state
     bool IsGridEnabled()
     {
-        for (const auto& kv : m_entitySignatures)
+        for (EntityID e : m_entities)
         {
-            EntityID e = kv.first;
             if (HasComponent<GridSettings_data>(e))
             {
                 const GridSettings_data& settings = GetComponent<GridSettings_data>(e);
@@ -595,9 +684,8 @@ public:
     /// Toggle collision overlay visibility
     void ToggleCollisionOverlay()
     {
-        for (const auto& kv : m_entitySignatures)
+        for (EntityID e : m_entities)
         {
-            EntityID e = kv.first;
             if (HasComponent<GridSettings_data>(e))
             {
                 GridSettings_data& settings = GetComponent<GridSettings_data>(e);
@@ -613,9 +701,8 @@ public:
     /// Toggle navigation overlay visibility
     void ToggleNavigationOverlay()
     {
-        for (const auto& kv : m_entitySignatures)
+        for (EntityID e : m_entities)
         {
-            EntityID e = kv.first;
             if (HasComponent<GridSettings_data>(e))
             {
                 GridSettings_data& settings = GetComponent<GridSettings_data>(e);
@@ -631,9 +718,8 @@ public:
     /// Get collision overlay state
     bool IsCollisionOverlayVisible()
     {
-        for (const auto& kv : m_entitySignatures)
+        for (EntityID e : m_entities)
         {
-            EntityID e = kv.first;
             if (HasComponent<GridSettings_data>(e))
             {
                 const GridSettings_data& settings = GetComponent<GridSettings_data>(e);
@@ -646,9 +732,8 @@ public:
     /// Get navigation overlay state
     bool IsNavigationOverlayVisible()
     {
-        for (const auto& kv : m_entitySignatures)
+        for (EntityID e : m_entities)
         {
-            EntityID e = kv.first;
             if (HasComponent<GridSettings_data>(e))
             {
                 const GridSettings_data& settings = GetComponent<GridSettings_data>(e);
@@ -664,23 +749,52 @@ public:
     /// Supports: orthogonal, isometric, hexagonal orientations
     void SyncGridWithLevel(const Olympe::Editor::LevelDefinition& levelDef);
 
-    // Public for inspection/debug
-    std::unordered_map<EntityID, ComponentSignature> m_entitySignatures;
-
 private:
-    // Mapping: TypeID -> Component Pool
-    std::unordered_map<ComponentTypeID, std::unique_ptr<IComponentPool>> m_componentPools;
+    // Per-slot entity record, indexed by GetEntityIndex()
+    struct EntitySlot
+    {
+        ComponentSignature signature;
+        std::uint32_t denseIndex = 0;  // Position in m_entities while alive (swap-remove)
+    };
+
+    // Mapping: TypeID -> Component Pool (indexed directly by type ID)
+    std::unique_ptr<IComponentPool> m_componentPools[MAX_COMPONENTS];
+
+    template <typename T>
+    ComponentPool<T>* GetOrCreatePool()
+    {
+        std::unique_ptr<IComponentPool>& slot = m_componentPools[GetComponentTypeID_Static<T>()];
+        if (!slot)
+        {
+            slot = std::make_unique<ComponentPool<T>>();
+        }
+        return static_cast<ComponentPool<T>*>(slot.get());
+    }
 
     // Entity ID management
-    EntityID m_nextEntityID = 1;
-    std::queue<EntityID> m_freeEntityIDs;
-    std::vector<EntityID> m_entities;
+    EntityHandleAllocator m_entityHandles;         // Generations, liveness and slot recycling
+    std::vector<EntitySlot> m_entitySlots;         // Indexed by entity index, slot 0 is reserved
+    std::vector<EntityID> m_entities;              // Packed list of live entities (unordered)
+    EntityCommandBuffer m_commandBuffer;
 
     // System management
     std::vector<std::unique_ptr<ECS_System>> m_systems;
+    ECS_Scheduler m_scheduler;
+
+    // Cached views: one packed entity set per queried signature
+    struct CachedView
+    {
+        ComponentSignature signature;
+        std::unique_ptr<EntitySet> entities;  // Heap-allocated so references stay stable
+    };
+    std::vector<CachedView> m_viewCache;
+    std::mutex m_viewMutex;
 
-    // Notifies systems when an Entity's signature changes
-    void Notify_ECS_Systems(EntityID entity, ComponentSignature signature);
+    // Returns the cached entity set for a signature (built on first request)
+    const EntitySet& GetCachedView(const ComponentSignature& signature);
+
+    // Notifies systems and cached views when an Entity's signature changes
+    void Notify_ECS_Systems(EntityID entity, const ComponentSignature& signature);
 
     // Helper functions for SFINAE-based special component registration (C++14 compatible)
 	// Helper function for SFINAE-based special component registration
@@ -692,7 +806,13 @@ private:
     }
 
     template <typename T>
-    void HandleSpecialComponentRegistration(EntityID entity, typename std::enable_if<!std::is_same<T, PlayerBinding_data>::value>::type* = nullptr)
+    void HandleSpecialComponentRegistration(EntityID entity, typename std::enable_if<std::is_same<T, Identity_data>::value>::type* = nullptr)
+    {
+        RefreshIdentity(entity);
+    }
+
+    template <typename T>
+    void HandleSpecialComponentRegistration(EntityID entity, typename std::enable_if<!std::is_same<T, PlayerBinding_data>::value && !std::is_same<T, Identity_data>::value>::type* = nullptr)
     {
 		// Do nothing for other types
     }
@@ -760,12 +880,41 @@ private:
 public:    
     // Get tile chunks (for rendering system)
     const std::vector<TileChunk>& GetTileChunks() const { return m_tileChunks; }
+
+    // Rebuild the spatial index over the tile chunks if the chunk list changed.
+    // Main thread only: RenderingSystem calls it before the views are prepared in parallel.
+    void RebuildTileChunkIndexIfNeeded()
+    {
+        if (m_tileChunkIndexDirty)
+        {
+            m_tileChunkIndex.Build(m_tileChunks);
+            m_tileChunkIndexDirty = false;
+        }
+    }
+
+    // Get the spatial index over the tile chunks (read-only, safe from render jobs)
+    const TileChunkIndex& GetTileChunkIndex() const
+    {
+        assert(!m_tileChunkIndexDirty && "RebuildTileChunkIndexIfNeeded() must run first");
+        return m_tileChunkIndex;
+    }
+    
+    // Get baked tile geometry (built by the rendering system on first use after a load)
+    Olympe::Rendering::TileGeometry& GetTileGeometry() { return m_tileGeometry; }
+    
+    // Get the render-to-texture cache of flat tile blocks
+    Olympe::Rendering::TileBlockCache& GetTileBlockCache() { return m_tileBlockCache; }
+    
+    // Change one tile at runtime (world tile coordinates): updates the chunk and
+    // re-bakes its block, which drops the block's cached textures
+    bool SetTileGID(const std::string& layerName, int worldX, int worldY, uint32_t gid);
     
     // Get tileset manager (for rendering system)
     TilesetManager& GetTilesetManager() { return m_tilesetManager; }
     
     // Get map configuration for rendering
     const std::string& GetMapOrientation() const { return m_mapOrientation; }
+    Olympe::Rendering::TileMapOrientation GetMapOrientationType() const { return m_mapOrientationType; }
     int GetTileWidth() const { return m_tileWidth; }
     int GetTileHeight() const { return m_tileHeight; }
     
@@ -792,7 +941,12 @@ public:
 private:
     TilesetManager m_tilesetManager;
     std::vector<TileChunk> m_tileChunks;
+    TileChunkIndex m_tileChunkIndex;
+    bool m_tileChunkIndexDirty = true;
+    Olympe::Rendering::TileGeometry m_tileGeometry;
+    Olympe::Rendering::TileBlockCache m_tileBlockCache;
     std::string m_mapOrientation;  // "orthogonal" or "isometric"
+    Olympe::Rendering::TileMapOrientation m_mapOrientationType = Olympe::Rendering::TileMapOrientation::Orthogonal;
     int m_tileWidth;
     int m_tileHeight;
     std::vector<std::unique_ptr<Level>> m_levels;
@@ -0,0 +1,206 @@
+#include "JobSystem.h"
+#include "system_utils.h"
+
+#include <chrono>
+#include <exception>
+
+namespace
+{
+    // Index of the queue owned by the current thread (0 for non-worker threads)
+    thread_local unsigned int t_queueIndex = 0;
+
+    // Counts a ParallelFor chunk as done however it leaves (return or exception)
+    struct ChunkDoneGuard
+    {
+        std::atomic<size_t>& remaining;
+        ~ChunkDoneGuard() { remaining.fetch_sub(1); }
+    };
+}
+
+JobSystem::JobSystem()
+{
+    // Shared queue for non-worker threads, always present
+    m_queues.emplace_back(new WorkQueue());
+}
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+//-------------------------------------------------------------
+void JobSystem::Initialize(unsigned int workerCount)
+{
+    if (m_running)
+        return;
+
+    if (workerCount == 0)
+    {
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+    }
+
+    m_queues.resize(1);
+    for (unsigned int i = 0; i < workerCount; ++i)
+        m_queues.emplace_back(new WorkQueue());
+
+    m_running = true;
+    for (unsigned int i = 0; i < workerCount; ++i)
+        m_workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+
+    SYSTEM_LOG << "JobSystem initialized with " << workerCount << " worker thread(s)\n";
+}
+//-------------------------------------------------------------
+void JobSystem::Shutdown()
+{
+    if (!m_running)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_running = false;
+    }
+    m_wakeCondition.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+    m_workers.clear();
+
+    // Jobs left in worker deques are moved to the shared queue so they are not lost
+    for (size_t i = 1; i < m_queues.size(); ++i)
+    {
+        for (Job& job : m_queues[i]->jobs)
+            m_queues[0]->jobs.push_back(std::move(job));
+    }
+    m_queues.resize(1);
+}
+//-------------------------------------------------------------
+void JobSystem::Submit(Job job)
+{
+    const unsigned int queueIndex = (t_queueIndex < m_queues.size()) ? t_queueIndex : 0;
+    {
+        WorkQueue& queue = *m_queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    m_pendingJobs.fetch_add(1);
+    m_wakeCondition.notify_one();
+}
+//-------------------------------------------------------------
+bool JobSystem::RunPendingJob()
+{
+    Job job;
+    const unsigned int queueIndex = (t_queueIndex < m_queues.size()) ? t_queueIndex : 0;
+    if (!PopOwn(queueIndex, job) && !Steal(queueIndex, job))
+        return false;
+
+    m_pendingJobs.fetch_sub(1);
+    job();
+    return true;
+}
+//-------------------------------------------------------------
+void JobSystem::ParallelFor(size_t count, size_t chunkSize, const std::function<void(size_t, size_t)>& fn)
+{
+    if (count == 0)
+        return;
+    if (chunkSize == 0)
+        chunkSize = count;
+
+    // Small ranges (or no workers): not worth the dispatch
+    const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    if (chunkCount == 1 || m_workers.empty())
+    {
+        fn(0, count);
+        return;
+    }
+
+    // An exception never leaves a chunk: the first one is kept and rethrown here once
+    // every chunk is done (the chunks reference this frame)
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+    auto runChunk = [&fn, &firstError, &errorMutex](size_t begin, size_t end) {
+        try
+        {
+            fn(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError)
+                firstError = std::current_exception();
+        }
+    };
+
+    // Chunks 1..N-1 go to the pool, chunk 0 runs here; then help until all are done
+    std::atomic<size_t> remaining(chunkCount - 1);
+    for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+    {
+        const size_t begin = chunk * chunkSize;
+        const size_t end = (begin + chunkSize < count) ? begin + chunkSize : count;
+        Submit([&runChunk, &remaining, begin, end]() {
+            ChunkDoneGuard done{ remaining };
+            runChunk(begin, end);
+        });
+    }
+
+    runChunk(0, (chunkSize < count) ? chunkSize : count);
+
+    while (remaining.load() > 0)
+    {
+        if (!RunPendingJob())
+            std::this_thread::yield();
+    }
+
+    if (firstError)
+        std::rethrow_exception(firstError);
+}
+//-------------------------------------------------------------
+bool JobSystem::PopOwn(unsigned int queueIndex, Job& outJob)
+{
+    WorkQueue& queue = *m_queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty())
+        return false;
+
+    // LIFO on the owner side: the most recently pushed job has the warmest data
+    outJob = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    return true;
+}
+//-------------------------------------------------------------
+bool JobSystem::Steal(unsigned int thiefIndex, Job& outJob)
+{
+    const size_t queueCount = m_queues.size();
+    for (size_t offset = 1; offset < queueCount; ++offset)
+    {
+        WorkQueue& victim = *m_queues[(thiefIndex + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.jobs.empty())
+            continue;
+
+        // FIFO on the thief side: take the oldest job, away from the owner's end
+        outJob = std::move(victim.jobs.front());
+        victim.jobs.pop_front();
+        return true;
+    }
+    return false;
+}
+//-------------------------------------------------------------
+void JobSystem::WorkerLoop(unsigned int queueIndex)
+{
+    t_queueIndex = queueIndex;
+
+    while (m_running)
+    {
+        if (RunPendingJob())
+            continue;
+
+        // Nothing to run: sleep until a job is submitted (the timeout covers missed wake-ups)
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.wait_for(lock, std::chrono::milliseconds(1), [this]() {
+            return m_pendingJobs.load() > 0 || !m_running;
+        });
+    }
+}
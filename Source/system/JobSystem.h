@@ -0,0 +1,84 @@
+/*
+Olympe Engine V2 - 2025
+Nicolas Chereau
+nchereau@gmail.com
+
+This file is part of Olympe Engine V2.
+
+JobSystem: Singleton work-stealing thread pool used by the ECS scheduler.
+Each worker owns a job deque: it pops its own jobs LIFO (cache-warm) and steals
+FIFO from the other workers when it runs dry. Threads that wait on jobs (the
+main thread during ECS processing) help by running pending jobs themselves.
+
+If Initialize() is never called (tools, tests) there are no workers and all
+jobs run on the thread calling RunPendingJob().
+
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem
+{
+public:
+    using Job = std::function<void()>;
+
+    JobSystem();
+    ~JobSystem();
+
+    // Singleton access
+    static JobSystem& GetInstance()
+    {
+        static JobSystem instance;
+        return instance;
+    }
+    static JobSystem& Get() { return GetInstance(); }
+
+    // Start the workers (0 = hardware threads - 1, the main thread being the last one)
+    void Initialize(unsigned int workerCount = 0);
+    void Shutdown();
+
+    unsigned int GetWorkerCount() const { return static_cast<unsigned int>(m_workers.size()); }
+
+    // Queue a job. Called from a worker, the job goes to that worker's own deque.
+    void Submit(Job job);
+
+    // Run one pending job on the calling thread. Returns false if no job was available.
+    bool RunPendingJob();
+
+    // Split [0, count) into chunks of 'chunkSize' items, run fn(begin, end) on each chunk
+    // in parallel and return when all are done. The calling thread processes chunks too.
+    // If fn throws, the other chunks still run; the first exception is rethrown here.
+    void ParallelFor(size_t count, size_t chunkSize, const std::function<void(size_t, size_t)>& fn);
+
+private:
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    void WorkerLoop(unsigned int workerIndex);
+    bool PopOwn(unsigned int queueIndex, Job& outJob);
+    bool Steal(unsigned int thiefIndex, Job& outJob);
+
+    // Queue 0 is shared by non-worker threads; worker i owns queue i + 1
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    std::atomic<int> m_pendingJobs{ 0 };
+    std::atomic<bool> m_running{ false };
+};
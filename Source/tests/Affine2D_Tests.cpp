@@ -0,0 +1,111 @@
+#include "../Rendering/Affine2D.h"
+#include "../Rendering/TileProjection.h"
+
+#include <cmath>
+#include <iostream>
+
+using Olympe::Rendering::Affine2D;
+using Olympe::Rendering::TileMapOrientation;
+using Olympe::Rendering::TileProjection;
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[Affine2DTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool Near(float a, float b, float tolerance)
+{
+    return std::fabs(a - b) <= tolerance * (1.0f + std::fabs(a) + std::fabs(b));
+}
+
+// Step-by-step camera transform (relative, rotate, zoom, offset, center)
+static void ReferenceWorldToScreen(float x, float y, float camX, float camY, float zoom, float rotation,
+                                   float offsetX, float offsetY, float viewW, float viewH, float& outX, float& outY)
+{
+    float rx = x - camX;
+    float ry = y - camY;
+    if (rotation != 0.0f)
+    {
+        const float rotRad = rotation * (3.14159265358979323846f / 180.0f);
+        const float c = std::cos(rotRad), s = std::sin(rotRad);
+        const float tx = rx * c - ry * s;
+        ry = rx * s + ry * c;
+        rx = tx;
+    }
+    outX = rx * zoom - offsetX + viewW / 2.0f;
+    outY = ry * zoom - offsetY + viewH / 2.0f;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        // Composed camera matrix against the step-by-step transform
+        const float rotations[] = { 0.0f, 30.0f, -90.0f, 217.5f };
+        const float zooms[] = { 0.25f, 1.0f, 3.0f };
+        bool match = true;
+        bool roundTrip = true;
+        for (float rotation : rotations)
+        {
+            for (float zoom : zooms)
+            {
+                const Affine2D m = Affine2D::Translate(640.0f - 12.0f, 360.0f + 7.0f)
+                    * Affine2D::RotateScale(rotation, zoom)
+                    * Affine2D::Translate(-1500.0f, 820.0f);
+                const Affine2D inv = m.Inverse();
+                for (int i = 0; i < 16; ++i)
+                {
+                    const float x = -900.0f + 231.0f * i;
+                    const float y = 450.0f - 97.0f * i;
+                    float refX, refY;
+                    ReferenceWorldToScreen(x, y, 1500.0f, -820.0f, zoom, rotation, 12.0f, -7.0f, 1280.0f, 720.0f, refX, refY);
+                    const float sx = m.ApplyX(x, y);
+                    const float sy = m.ApplyY(x, y);
+                    match = match && Near(sx, refX, 1e-5f) && Near(sy, refY, 1e-5f);
+                    roundTrip = roundTrip && Near(inv.ApplyX(sx, sy), x, 1e-5f) && Near(inv.ApplyY(sx, sy), y, 1e-5f);
+                }
+            }
+        }
+        ok = AssertTrue(match, "Composed matrix matches the step-by-step transform") && ok;
+        ok = AssertTrue(roundTrip, "Inverse maps screen points back to the world") && ok;
+    }
+
+    {
+        const Affine2D identity;
+        ok = AssertTrue(identity.ApplyX(3.5f, -2.0f) == 3.5f && identity.ApplyY(3.5f, -2.0f) == -2.0f, "Default is identity") && ok;
+        const Affine2D quarter = Affine2D::RotateScale(90.0f, 2.0f);
+        ok = AssertTrue(Near(quarter.ApplyX(1.0f, 0.0f), 0.0f, 1e-6f) && Near(quarter.ApplyY(1.0f, 0.0f), 2.0f, 1e-6f),
+                        "Positive angles turn clockwise on screen (y down)") && ok;
+    }
+
+    {
+        // Projections against the per-orientation formulas
+        float left, top;
+        TileProjection<TileMapOrientation::Orthogonal>::QuadOrigin(7, -3, 32, 32, 32, 16, left, top);
+        ok = AssertTrue(left == 224.0f && top == -48.0f, "Orthogonal origin") && ok;
+        ok = AssertTrue(TileProjection<TileMapOrientation::Orthogonal>::DepthBand(7, -3) == -3, "Orthogonal band is the row") && ok;
+
+        TileProjection<TileMapOrientation::Isometric>::QuadOrigin(5, 2, 64, 48, 64, 32, left, top);
+        ok = AssertTrue(left == (5 - 2) * 32.0f - 32.0f && top == (5 + 2) * 16.0f - 48.0f + 32.0f, "Isometric origin") && ok;
+        ok = AssertTrue(TileProjection<TileMapOrientation::Isometric>::DepthBand(5, 2) == 7, "Isometric band is the diagonal") && ok;
+
+        TileProjection<TileMapOrientation::Hexagonal>::QuadOrigin(4, 3, 64, 64, 64, 64, left, top);
+        const float radius = 32.0f;
+        ok = AssertTrue(Near(left, radius * (std::sqrt(3.0f) * 4 + std::sqrt(3.0f) / 2.0f * 3), 1e-6f)
+                        && top == radius * 1.5f * 3, "Hexagonal origin") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[Affine2DTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,97 @@
+#include "../Rendering/AtlasPacker.h"
+
+#include <iostream>
+#include <vector>
+
+using Olympe::Rendering::AtlasPacker;
+using Olympe::Rendering::AtlasRect;
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[AtlasPackerTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool Overlap(const AtlasRect& a, const AtlasRect& b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static bool AllValid(const std::vector<AtlasRect>& rects, int width, int height)
+{
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        const AtlasRect& r = rects[i];
+        if (r.x < 0 || r.y < 0 || r.x + r.w > width || r.y + r.h > height)
+            return false;
+        for (size_t j = i + 1; j < rects.size(); ++j)
+            if (Overlap(r, rects[j]))
+                return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        // Sprites in load order (random sizes), until the page is full
+        AtlasPacker packer(1024, 1024);
+        std::vector<AtlasRect> rects;
+        std::uint32_t seed = 4242u;
+        int failures = 0;
+        for (int i = 0; i < 2000 && failures < 20; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int w = 8 + static_cast<int>((seed >> 8) % 58);
+            const int h = 8 + static_cast<int>((seed >> 20) % 58);
+            AtlasRect rect;
+            if (packer.Insert(w, h, rect))
+            {
+                ok = AssertTrue(rect.w == w && rect.h == h, "Packed rect keeps its size") && ok;
+                rects.push_back(rect);
+            }
+            else
+            {
+                ++failures;
+            }
+        }
+        ok = AssertTrue(AllValid(rects, 1024, 1024), "Packed rects are inside the page and disjoint") && ok;
+        ok = AssertTrue(packer.GetOccupancy() > 0.75f, "Page is densely packed") && ok;
+    }
+
+    {
+        // Same-size sprites (crowd of NPCs) tile the page exactly
+        AtlasPacker packer(256, 256);
+        std::vector<AtlasRect> rects;
+        AtlasRect rect;
+        while (packer.Insert(34, 34, rect))
+            rects.push_back(rect);
+        ok = AssertTrue(rects.size() == 7 * 7 && AllValid(rects, 256, 256), "Uniform sprites fill the page") && ok;
+    }
+
+    {
+        AtlasPacker packer(64, 64);
+        AtlasRect rect;
+        ok = AssertTrue(!packer.Insert(65, 8, rect) && !packer.Insert(8, 65, rect), "Oversized rect is rejected") && ok;
+        ok = AssertTrue(!packer.Insert(0, 8, rect), "Empty rect is rejected") && ok;
+        ok = AssertTrue(packer.Insert(64, 64, rect) && rect.x == 0 && rect.y == 0, "Rect filling the page") && ok;
+        ok = AssertTrue(!packer.Insert(1, 1, rect), "Full page") && ok;
+
+        packer.Reset(64, 64);
+        ok = AssertTrue(packer.GetOccupancy() == 0.0f && packer.Insert(32, 32, rect), "Reset page") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[AtlasPackerTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
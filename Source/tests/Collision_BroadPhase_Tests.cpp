@@ -2,6 +2,8 @@
 
 #include "../system/system_utils.h"
 
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 static bool AssertTrue(bool condition, const char* label)
@@ -56,6 +58,19 @@ static bool SamePairs(const std::vector<Olympe::Collision_CandidatePair>& lhs,
     return true;
 }
 
+static bool PairLess(const Olympe::Collision_CandidatePair& lhs,
+                     const Olympe::Collision_CandidatePair& rhs)
+{
+    return lhs.a < rhs.a || (lhs.a == rhs.a && lhs.b < rhs.b);
+}
+
+// Deterministic pseudo-random values in [0, 1)
+static float NextUnit(unsigned int& state)
+{
+    state = state * 1664525u + 1013904223u;
+    return static_cast<float>(state >> 8) / 16777216.0f;
+}
+
 int main()
 {
     bool ok = true;
@@ -197,6 +212,379 @@ int main()
         ok = AssertTrue(scratch.normalizedPairs.capacity() == pairCapacity, "Scratch reuse -> pair capacity stable") && ok;
     }
 
+    {
+        // Incremental SAP against brute force over moving frames, with proxies leaving and coming back
+        std::vector<Olympe::Collision_SpatialProxy> proxies;
+        unsigned int state = 12345u;
+        for (EntityID i = 1; i <= 64; ++i)
+        {
+            Olympe::Collision_SpatialProxy proxy;
+            proxy.entity = i;
+            const float x = NextUnit(state) * 40.0f;
+            const float y = NextUnit(state) * 40.0f;
+            proxy.worldAABB = MakeAABB(x, y, x + 1.0f + NextUnit(state) * 3.0f, y + 1.0f + NextUnit(state) * 3.0f);
+            proxies.push_back(proxy);
+        }
+
+        Olympe::Collision_IncrementalSweepAndPrune incremental;
+        Olympe::Collision_BroadPhaseScratch scratch;
+        Olympe::Collision_BroadPhaseMetrics metrics;
+        std::vector<Olympe::Collision_CandidatePair> previousPairs;
+        std::vector<Olympe::Collision_CandidatePair> brutePairs;
+        std::vector<Olympe::Collision_CandidatePair> incrementalPairs;
+        std::vector<Olympe::Collision_CandidatePair> added;
+        std::vector<Olympe::Collision_CandidatePair> removed;
+        std::vector<Olympe::Collision_CandidatePair> expectedAdded;
+        std::vector<Olympe::Collision_CandidatePair> expectedRemoved;
+
+        bool matchesBruteForce = true;
+        bool reportsChanges = true;
+        for (int frame = 0; frame < 40; ++frame)
+        {
+            std::vector<Olympe::Collision_SpatialProxy> live;
+            for (size_t index = 0; index < proxies.size(); ++index)
+            {
+                Olympe::Collision_SpatialProxy& proxy = proxies[index];
+                const float dx = (NextUnit(state) - 0.5f) * 1.5f;
+                const float dy = (NextUnit(state) - 0.5f) * 1.5f;
+                proxy.worldAABB.min.x += dx;
+                proxy.worldAABB.max.x += dx;
+                proxy.worldAABB.min.y += dy;
+                proxy.worldAABB.max.y += dy;
+
+                // Every 7th proxy is missing on odd frames
+                if ((frame % 2) == 1 && (proxy.entity % 7) == 0)
+                {
+                    incremental.RemoveProxy(proxy.entity);
+                    continue;
+                }
+
+                incremental.SetProxy(proxy.entity, proxy.worldAABB);
+                live.push_back(proxy);
+            }
+
+            incremental.Update(added, removed, &metrics, Olympe::Collision_BroadPhaseFilter());
+            incremental.GetPairs(incrementalPairs);
+            Olympe::Collision_ComputeBroadPhasePairsBruteForce(live, brutePairs, scratch, 0, Olympe::Collision_BroadPhaseFilter());
+
+            expectedAdded.clear();
+            expectedRemoved.clear();
+            std::set_difference(brutePairs.begin(), brutePairs.end(), previousPairs.begin(), previousPairs.end(),
+                                std::back_inserter(expectedAdded), PairLess);
+            std::set_difference(previousPairs.begin(), previousPairs.end(), brutePairs.begin(), brutePairs.end(),
+                                std::back_inserter(expectedRemoved), PairLess);
+
+            matchesBruteForce = matchesBruteForce && SamePairs(incrementalPairs, brutePairs) &&
+                                metrics.pairsAfterDedup == brutePairs.size() &&
+                                incremental.GetProxyCount() == live.size();
+            reportsChanges = reportsChanges && SamePairs(added, expectedAdded) && SamePairs(removed, expectedRemoved);
+            previousPairs = brutePairs;
+        }
+
+        ok = AssertTrue(matchesBruteForce, "Incremental SAP -> matches brute force every frame") && ok;
+        ok = AssertTrue(reportsChanges, "Incremental SAP -> reports exactly the added and removed pairs") && ok;
+        ok = AssertTrue(!previousPairs.empty(), "Incremental SAP -> scene has overlaps") && ok;
+
+        // Nothing moved: one comparison per endpoint, no pair tested
+        incremental.Update(added, removed, &metrics, Olympe::Collision_BroadPhaseFilter());
+        const size_t endpointCount = incremental.GetProxyCount() * 2;
+        ok = AssertTrue(added.empty() && removed.empty(), "Incremental SAP -> still frame reports nothing") && ok;
+        ok = AssertTrue(metrics.comparisons == 2 * (endpointCount - 1), "Incremental SAP -> still frame is linear") && ok;
+        ok = AssertTrue(metrics.pairsBeforeDedup == 0 && metrics.axisRejectedPairs == 0,
+                        "Incremental SAP -> still frame tests no pair") && ok;
+    }
+
+    {
+        Olympe::Collision_IncrementalSweepAndPrune incremental;
+        incremental.SetProxy(100, MakeAABB(0.0f, 0.0f, 1.0f, 1.0f));
+        incremental.SetProxy(200, MakeAABB(1.0f, 0.0f, 2.0f, 1.0f));
+        incremental.SetProxy(300, MakeAABB(1.5f, 0.5f, 2.5f, 1.5f));
+
+        EntityID rejectedPair[2] = {100, 200};
+        Olympe::Collision_BroadPhaseFilter filter;
+        filter.predicate = &RejectSpecificPair;
+        filter.userData = rejectedPair;
+
+        std::vector<Olympe::Collision_CandidatePair> added;
+        std::vector<Olympe::Collision_CandidatePair> removed;
+        Olympe::Collision_BroadPhaseMetrics metrics;
+        incremental.Update(added, removed, &metrics, filter);
+
+        ok = AssertTrue(added.size() == 1 && added[0].a == 200 && added[0].b == 300, "Incremental filter -> only allowed pair") && ok;
+        ok = AssertTrue(metrics.filteredPairs > 0, "Incremental filter -> metrics count rejected pair") && ok;
+
+        // Invalid box: the proxy is dropped with its pairs
+        incremental.SetProxy(300, MakeAABB(5.0f, 5.0f, 2.0f, 2.0f));
+        incremental.Update(added, removed, &metrics, filter);
+
+        ok = AssertTrue(removed.size() == 1 && removed[0].a == 200 && removed[0].b == 300, "Incremental invalid -> pair removed") && ok;
+        ok = AssertTrue(metrics.invalidProxyCount == 1 && metrics.validProxyCount == 2, "Incremental invalid -> counted") && ok;
+        ok = AssertTrue(incremental.GetProxyCount() == 2 && incremental.GetPairCount() == 0, "Incremental invalid -> proxy gone") && ok;
+    }
+
+    {
+        // Entity index recycled between two updates: the old handle's pairs end, the new one's begin
+        Olympe::Collision_IncrementalSweepAndPrune incremental;
+        const EntityID oldEntity = MakeEntityID(5, 0);
+        const EntityID newEntity = MakeEntityID(5, 1);
+        incremental.SetProxy(2, MakeAABB(0.0f, 0.0f, 2.0f, 2.0f));
+        incremental.SetProxy(oldEntity, MakeAABB(1.0f, 1.0f, 3.0f, 3.0f));
+
+        std::vector<Olympe::Collision_CandidatePair> added;
+        std::vector<Olympe::Collision_CandidatePair> removed;
+        incremental.Update(added, removed, 0, Olympe::Collision_BroadPhaseFilter());
+
+        incremental.RemoveProxy(oldEntity);
+        incremental.SetProxy(newEntity, MakeAABB(1.5f, 1.5f, 3.0f, 3.0f));
+        incremental.Update(added, removed, 0, Olympe::Collision_BroadPhaseFilter());
+
+        ok = AssertTrue(removed.size() == 1 && removed[0].a == 2 && removed[0].b == oldEntity &&
+                        added.size() == 1 && added[0].a == 2 && added[0].b == newEntity,
+                        "Incremental recycled index -> old pair removed, new pair added") && ok;
+        ok = AssertTrue(incremental.GetProxyCount() == 2 && incremental.GetPairCount() == 1, "Incremental recycled index -> counts") && ok;
+
+        incremental.RemoveProxy(newEntity);
+        incremental.Update(added, removed, 0, Olympe::Collision_BroadPhaseFilter());
+        ok = AssertTrue(removed.size() == 1 && removed[0].b == newEntity && incremental.GetProxyCount() == 1,
+                        "Incremental recycled index -> new handle removable") && ok;
+    }
+
+    {
+        // Spatial hash against brute force: mixed sizes over several levels, negative
+        // coordinates, boxes touching across a cell border, oversized boxes
+        std::vector<Olympe::Collision_SpatialProxy> proxies;
+        unsigned int state = 777u;
+        for (EntityID i = 1; i <= 300; ++i)
+        {
+            Olympe::Collision_SpatialProxy proxy;
+            proxy.entity = i;
+            const float x = NextUnit(state) * 200.0f - 100.0f;
+            const float y = NextUnit(state) * 200.0f - 100.0f;
+            const float size = ((i % 10) == 0) ? 10.0f + NextUnit(state) * 40.0f : 0.5f + NextUnit(state) * 3.0f;
+            proxy.worldAABB = MakeAABB(x, y, x + size, y + size * 0.5f);
+            proxies.push_back(proxy);
+        }
+
+        Olympe::Collision_SpatialProxy touching;
+        touching.entity = 301;
+        touching.worldAABB = MakeAABB(3.0f, 300.0f, 4.0f - 0.00005f, 301.0f);
+        proxies.push_back(touching);
+        touching.entity = 302;
+        touching.worldAABB = MakeAABB(4.0f, 300.0f, 5.0f, 301.0f);
+        proxies.push_back(touching);
+
+        Olympe::Collision_SpatialProxy oversized;
+        oversized.entity = 303;
+        oversized.worldAABB = MakeAABB(-5000.0f, -1.0f, 5000.0f, 1.0f);
+        proxies.push_back(oversized);
+        oversized.entity = 304;
+        oversized.worldAABB = MakeAABB(-2.0f, -5000.0f, 2.0f, 5000.0f);
+        proxies.push_back(oversized);
+
+        Olympe::Collision_SpatialHashConfig levels;
+        levels.cellSizes.clear();
+        levels.cellSizes.push_back(4.0f);
+        levels.cellSizes.push_back(16.0f);
+        levels.cellSizes.push_back(64.0f);
+
+        std::vector<Olympe::Collision_CandidatePair> brutePairs;
+        std::vector<Olympe::Collision_CandidatePair> hashPairs;
+        std::vector<Olympe::Collision_CandidatePair> singleLevelPairs;
+        Olympe::Collision_BroadPhaseScratch scratch;
+        Olympe::Collision_BroadPhaseMetrics metrics;
+
+        Olympe::Collision_ComputeBroadPhasePairsBruteForce(proxies, brutePairs, scratch, 0, Olympe::Collision_BroadPhaseFilter());
+        Olympe::Collision_ComputeBroadPhasePairsSpatialHash(proxies, hashPairs, scratch, &metrics, Olympe::Collision_BroadPhaseFilter(), levels);
+        Olympe::Collision_ComputeBroadPhasePairsSpatialHash(proxies, singleLevelPairs, scratch, 0, Olympe::Collision_BroadPhaseFilter(),
+                                                            Olympe::Collision_SpatialHashConfig());
+
+        ok = AssertTrue(SamePairs(hashPairs, brutePairs), "Spatial hash -> matches brute force") && ok;
+        ok = AssertTrue(SamePairs(singleLevelPairs, brutePairs), "Spatial hash single level -> matches brute force") && ok;
+        ok = AssertTrue(std::is_sorted(hashPairs.begin(), hashPairs.end(), PairLess),
+                        "Spatial hash -> pairs sorted") && ok;
+        ok = AssertTrue(metrics.pairsAfterDedup == brutePairs.size() && metrics.maxActiveCount > 0,
+                        "Spatial hash -> metrics recorded") && ok;
+
+        EntityID rejectedPair[2] = {301, 302};
+        Olympe::Collision_BroadPhaseFilter filter;
+        filter.predicate = &RejectSpecificPair;
+        filter.userData = rejectedPair;
+        Olympe::Collision_ComputeBroadPhasePairsBruteForce(proxies, brutePairs, scratch, 0, filter);
+        Olympe::Collision_ComputeBroadPhasePairsSpatialHash(proxies, hashPairs, scratch, &metrics, filter, levels);
+        ok = AssertTrue(SamePairs(hashPairs, brutePairs) && metrics.filteredPairs > 0, "Spatial hash filter -> matches brute force") && ok;
+    }
+
+    {
+        // Backend selection: a crowd sharing an x range goes to the grid, a spread-out line stays on SAP
+        std::vector<Olympe::Collision_SpatialProxy> crowd;
+        std::vector<Olympe::Collision_SpatialProxy> line;
+        unsigned int state = 4242u;
+        for (EntityID i = 1; i <= 500; ++i)
+        {
+            Olympe::Collision_SpatialProxy proxy;
+            proxy.entity = i;
+            const float x = NextUnit(state) * 10.0f;
+            const float y = NextUnit(state) * 5000.0f;
+            proxy.worldAABB = MakeAABB(x, y, x + 2.0f, y + 2.0f);
+            crowd.push_back(proxy);
+
+            const float along = static_cast<float>(i) * 10.0f;
+            proxy.worldAABB = MakeAABB(along, along, along + 2.0f, along + 2.0f);
+            line.push_back(proxy);
+        }
+
+        Olympe::Collision_BroadPhaseScratch scratch;
+        Olympe::Collision_ProxyDistributionStats crowdStats;
+        Olympe::Collision_ProxyDistributionStats lineStats;
+        Olympe::Collision_ComputeProxyDistributionStats(crowd, crowdStats, scratch);
+        Olympe::Collision_ComputeProxyDistributionStats(line, lineStats, scratch);
+
+        ok = AssertTrue(crowdStats.proxyCount == 500 && crowdStats.meanWidth == 2.0f, "Distribution stats -> counts and sizes") && ok;
+        ok = AssertTrue(Olympe::Collision_SelectBroadPhaseBackend(crowdStats) == Olympe::Collision_BroadPhaseBackend::SpatialHash,
+                        "Backend selection -> crowd uses the grid") && ok;
+        ok = AssertTrue(Olympe::Collision_SelectBroadPhaseBackend(lineStats) == Olympe::Collision_BroadPhaseBackend::SweepAndPrune,
+                        "Backend selection -> spread-out proxies use SAP") && ok;
+
+        const Olympe::Collision_SpatialHashConfig config = Olympe::Collision_MakeSpatialHashConfig(crowdStats);
+        ok = AssertTrue(config.cellSizes.size() == 1 && config.cellSizes[0] == 4.0f, "Grid config -> cell of twice the mean extent") && ok;
+
+        std::vector<Olympe::Collision_CandidatePair> sapPairs;
+        std::vector<Olympe::Collision_CandidatePair> hashPairs;
+        Olympe::Collision_BroadPhaseMetrics sapMetrics;
+        Olympe::Collision_BroadPhaseMetrics hashMetrics;
+        Olympe::Collision_ComputeBroadPhasePairs(crowd, sapPairs, scratch, &sapMetrics, Olympe::Collision_BroadPhaseFilter());
+        Olympe::Collision_ComputeBroadPhasePairsSpatialHash(crowd, hashPairs, scratch, &hashMetrics, Olympe::Collision_BroadPhaseFilter(), config);
+        ok = AssertTrue(SamePairs(sapPairs, hashPairs), "Crowd -> grid matches SAP") && ok;
+        ok = AssertTrue(hashMetrics.comparisons < sapMetrics.comparisons, "Crowd -> grid does fewer comparisons") && ok;
+    }
+
+    {
+        // Flat proxy registry: handles survive swap-and-pop, stale handles and entities are rejected
+        Olympe::Collision_SpatialProxyRegistry registry;
+        const Olympe::Collision_ProxyHandle first = registry.RegisterOrUpdateProxy(MakeEntityID(1, 0), MakeAABB(0.0f, 0.0f, 1.0f, 1.0f));
+        const Olympe::Collision_ProxyHandle second = registry.RegisterOrUpdateProxy(MakeEntityID(2, 0), MakeAABB(5.0f, 0.0f, 6.0f, 1.0f));
+        const Olympe::Collision_ProxyHandle third = registry.RegisterOrUpdateProxy(MakeEntityID(3, 0), MakeAABB(0.5f, 0.5f, 1.5f, 1.5f));
+
+        ok = AssertTrue(registry.GetProxyCount() == 3 && registry.FindProxy(MakeEntityID(2, 0)) == second, "Registry -> register and find") && ok;
+        ok = AssertTrue(registry.RegisterOrUpdateProxy(MakeEntityID(2, 0), MakeAABB(5.0f, 1.0f, 6.0f, 2.0f)) == second &&
+                        registry.GetProxy(second)->worldAABB.min.y == 1.0f, "Registry -> update keeps the handle") && ok;
+        ok = AssertTrue(registry.RegisterOrUpdateProxy(MakeEntityID(4, 0), MakeAABB(2.0f, 2.0f, 1.0f, 1.0f)) == Olympe::COLLISION_INVALID_PROXY_HANDLE &&
+                        registry.GetProxyCount() == 3, "Registry -> invalid AABB ignored") && ok;
+
+        registry.RemoveProxy(MakeEntityID(1, 0));
+        ok = AssertTrue(registry.GetProxy(first) == nullptr && registry.FindProxy(MakeEntityID(1, 0)) == Olympe::COLLISION_INVALID_PROXY_HANDLE,
+                        "Registry -> removed handle rejected") && ok;
+        ok = AssertTrue(registry.GetProxy(third) && registry.GetProxy(third)->entity == MakeEntityID(3, 0),
+                        "Registry -> moved proxy keeps its handle") && ok;
+        ok = AssertTrue(registry.UpdateProxy(third, MakeAABB(0.0f, 0.0f, 2.0f, 2.0f)) && !registry.UpdateProxy(first, MakeAABB(0.0f, 0.0f, 2.0f, 2.0f)),
+                        "Registry -> update through handles") && ok;
+
+        // Recycled slot and recycled entity index
+        const Olympe::Collision_ProxyHandle reused = registry.RegisterOrUpdateProxy(MakeEntityID(1, 1), MakeAABB(9.0f, 9.0f, 10.0f, 10.0f));
+        ok = AssertTrue(reused != first && registry.GetProxy(first) == nullptr, "Registry -> recycled slot gets a new generation") && ok;
+        ok = AssertTrue(registry.FindProxy(MakeEntityID(1, 0)) == Olympe::COLLISION_INVALID_PROXY_HANDLE &&
+                        registry.FindProxy(MakeEntityID(1, 1)) == reused, "Registry -> older entity on the same index rejected") && ok;
+
+        // Batched updates: from proxies, then from an entity range
+        std::vector<Olympe::Collision_SpatialProxy> batch;
+        for (EntityID i = 10; i < 20; ++i)
+        {
+            Olympe::Collision_SpatialProxy proxy;
+            proxy.entity = i;
+            proxy.worldAABB = MakeAABB(static_cast<float>(i), 0.0f, static_cast<float>(i) + 1.5f, 1.0f);
+            batch.push_back(proxy);
+        }
+        registry.RegisterOrUpdateProxies(batch.data(), batch.size());
+
+        std::vector<EntityID> entities;
+        entities.push_back(10);
+        entities.push_back(11);
+        registry.UpdateProxies(entities, [](EntityID entity, Olympe::Collision_AABB& out)
+        {
+            out = MakeAABB(100.0f, 100.0f, 101.0f, 101.0f);
+            return entity != 11;
+        });
+        ok = AssertTrue(registry.GetProxyCount() == 12 && registry.FindProxy(11) == Olympe::COLLISION_INVALID_PROXY_HANDLE &&
+                        registry.GetProxy(registry.FindProxy(10))->worldAABB.min.x == 100.0f, "Registry -> batched updates") && ok;
+
+        // Zero-copy span and snapshot give the same broad phase
+        std::vector<Olympe::Collision_SpatialProxy> snapshot;
+        registry.GetSnapshot(snapshot);
+        const Olympe::Collision_SpatialProxySpan span = registry.GetProxies();
+        ok = AssertTrue(span.size == snapshot.size() && span[0].entity == snapshot[0].entity, "Registry -> span and snapshot agree") && ok;
+
+        std::vector<Olympe::Collision_CandidatePair> spanPairs;
+        std::vector<Olympe::Collision_CandidatePair> snapshotPairs;
+        Olympe::Collision_BroadPhaseScratch scratch;
+        Olympe::Collision_ComputeBroadPhasePairs(span, spanPairs, scratch, 0, Olympe::Collision_BroadPhaseFilter());
+        Olympe::Collision_ComputeBroadPhasePairsBruteForce(snapshot, snapshotPairs, scratch, 0, Olympe::Collision_BroadPhaseFilter());
+        ok = AssertTrue(!spanPairs.empty() && SamePairs(spanPairs, snapshotPairs), "Registry -> broad phase over the span") && ok;
+
+        registry.Clear();
+        ok = AssertTrue(registry.GetProxyCount() == 0 && registry.GetProxies().empty(), "Registry -> clear") && ok;
+    }
+
+    {
+        // Recycled entity index registered before the old entity was removed: no ghost proxy
+        Olympe::Collision_SpatialProxyRegistry registry;
+        registry.RegisterOrUpdateProxy(MakeEntityID(5, 0), MakeAABB(0.0f, 0.0f, 1.0f, 1.0f));
+        const Olympe::Collision_ProxyHandle recycled = registry.RegisterOrUpdateProxy(MakeEntityID(5, 1), MakeAABB(2.0f, 2.0f, 3.0f, 3.0f));
+        const Olympe::Collision_SpatialProxySpan span = registry.GetProxies();
+        ok = AssertTrue(registry.GetProxyCount() == 1 && span.size == 1 && span[0].entity == MakeEntityID(5, 1) &&
+                        registry.FindProxy(MakeEntityID(5, 1)) == recycled,
+                        "Registry -> recycled index replaces the old proxy") && ok;
+
+        registry.RemoveProxy(MakeEntityID(5, 0));
+        ok = AssertTrue(registry.GetProxyCount() == 1, "Registry -> stale entity removal ignored") && ok;
+        registry.RemoveProxy(MakeEntityID(5, 1));
+        ok = AssertTrue(registry.GetProxyCount() == 0 && registry.GetProxies().empty(), "Registry -> recycled proxy removable") && ok;
+    }
+
+    {
+        // One slot churned past all of its generations is retired, never wrapped
+        Olympe::Collision_SpatialProxyRegistry registry;
+        const EntityID entity = MakeEntityID(1, 0);
+        const Olympe::Collision_ProxyHandle first = registry.RegisterOrUpdateProxy(entity, MakeAABB(0.0f, 0.0f, 1.0f, 1.0f));
+        std::vector<Olympe::Collision_ProxyHandle> issued(1, first);
+        for (int reuse = 0; reuse < 4096 + 100; ++reuse)
+        {
+            registry.RemoveProxy(entity);
+            issued.push_back(registry.RegisterOrUpdateProxy(entity, MakeAABB(0.0f, 0.0f, 1.0f, 1.0f)));
+        }
+        const Olympe::Collision_ProxyHandle current = issued.back();
+        std::sort(issued.begin(), issued.end());
+
+        ok = AssertTrue(std::adjacent_find(issued.begin(), issued.end()) == issued.end() &&
+                        !std::binary_search(issued.begin(), issued.end(), Olympe::COLLISION_INVALID_PROXY_HANDLE),
+                        "Registry churn -> every handle unique and valid") && ok;
+        ok = AssertTrue(registry.GetProxy(first) == nullptr && registry.GetRetiredSlotCount() == 1 &&
+                        registry.FindProxy(entity) == current && (current & 0xFFFFFu) == 1u,
+                        "Registry churn -> saturated slot retired") && ok;
+    }
+
+    {
+        // Slot space exhausted: registration rejected, never the invalid handle or an aliased slot
+        Olympe::Collision_SpatialProxyRegistry registry;
+        const uint32_t slotCount = (1u << 20) - 1;
+        bool allValid = true;
+        for (uint32_t i = 0; i < slotCount; ++i)
+        {
+            const Olympe::Collision_ProxyHandle handle = registry.RegisterOrUpdateProxy(MakeEntityID(i + 1, 0), MakeAABB(0.0f, 0.0f, 1.0f, 1.0f));
+            allValid = allValid && handle != Olympe::COLLISION_INVALID_PROXY_HANDLE && (handle & 0xFFFFFu) == i;
+        }
+        ok = AssertTrue(allValid && registry.GetProxyCount() == slotCount, "Registry full -> every slot below the mask issued") && ok;
+
+        // Index 0 is the only one not mapped yet (never allocated by the World)
+        const EntityID extra = MakeEntityID(0, 1);
+        ok = AssertTrue(registry.RegisterOrUpdateProxy(extra, MakeAABB(0.0f, 0.0f, 1.0f, 1.0f)) == Olympe::COLLISION_INVALID_PROXY_HANDLE &&
+                        registry.GetProxyCount() == slotCount && registry.GetProxy(registry.FindProxy(MakeEntityID(1, 0))) != nullptr,
+                        "Registry full -> registration rejected") && ok;
+
+        registry.RemoveProxy(MakeEntityID(3, 0));
+        ok = AssertTrue(registry.RegisterOrUpdateProxy(extra, MakeAABB(0.0f, 0.0f, 1.0f, 1.0f)) != Olympe::COLLISION_INVALID_PROXY_HANDLE,
+                        "Registry full -> freed slot reused") && ok;
+    }
+
     if (!ok)
     {
         SYSTEM_LOG << "[CollisionBroadPhaseTest] FAIL" << std::endl;
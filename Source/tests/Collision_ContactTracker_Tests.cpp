@@ -0,0 +1,188 @@
+#include "../ECS_Register.h"
+#include "../ECS_View.h"
+#include "../ECS_Systems_Collision.h"
+
+#include <iostream>
+#include <vector>
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[CollisionContactTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool HasPair(const std::vector<Olympe::Collision_Contact>& contacts, EntityID a, EntityID b)
+{
+    for (const Olympe::Collision_Contact& contact : contacts)
+    {
+        if (contact.a == a && contact.b == b)
+            return true;
+    }
+    return false;
+}
+
+// Deterministic pseudo-random values in [0, 1)
+static float NextUnit(unsigned int& state)
+{
+    state = state * 1664525u + 1013904223u;
+    return static_cast<float>(state >> 8) / 16777216.0f;
+}
+
+static bool SameContacts(const std::vector<Olympe::Collision_Contact>& lhs, const std::vector<Olympe::Collision_Contact>& rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        if (lhs[i].a != rhs[i].a || lhs[i].b != rhs[i].b ||
+            lhs[i].result.penetration != rhs[i].result.penetration ||
+            lhs[i].result.normal.x != rhs[i].result.normal.x || lhs[i].result.normal.y != rhs[i].result.normal.y ||
+            lhs[i].result.point.x != rhs[i].result.point.x || lhs[i].result.point.y != rhs[i].result.point.y)
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        // Entities moved through GetComponent() (no change tick) still get their contacts
+        ComponentPool<Position_data> positions;
+        ComponentPool<BoundingBox_data> boxes;
+        EntitySet entities;
+        for (EntityID e = 1; e <= 3; ++e)
+        {
+            positions.AddComponent(e);
+            positions.GetComponent(e).position.x = static_cast<float>(e) * 100.0f;
+            boxes.AddComponent(e);
+            boxes.GetComponent(e).boundingBox = { 0.0f, 0.0f, 32.0f, 32.0f };
+            entities.insert(e);
+        }
+        ComponentView<Position_data, BoundingBox_data> view(entities, &positions, &boxes);
+
+        Olympe::Collision_ContactTracker tracker;
+        std::vector<Olympe::Collision_Contact> began, ended;
+        ok = AssertTrue(CollisionSystem::SyncProxies(entities, view, tracker) == 3, "First run queues every box") && ok;
+        ok = AssertTrue(tracker.Update(began, ended) && began.empty() && ended.empty(), "Separated boxes") && ok;
+
+        AdvanceChangeTick();
+        const ChangeTick stamped = positions.GetChangedTick(2);
+        positions.GetComponent(2).position.x = 120.0f;
+        ok = AssertTrue(positions.GetChangedTick(2) == stamped, "GetComponent write is not stamped") && ok;
+
+        ok = AssertTrue(CollisionSystem::SyncProxies(entities, view, tracker) == 1, "Only the moved box is queued") && ok;
+        ok = AssertTrue(tracker.Update(began, ended) && began.size() == 1 && HasPair(began, 1, 2) && ended.empty(),
+                        "Contact begins after a GetComponent move") && ok;
+        ok = AssertTrue(began[0].result.penetration == 12.0f && tracker.GetContacts().size() == 1, "Contact data") && ok;
+
+        ok = AssertTrue(CollisionSystem::SyncProxies(entities, view, tracker) == 0 && !tracker.Update(began, ended),
+                        "Nothing moved: no update") && ok;
+
+        positions.GetComponent(2).position.x = 280.0f;
+        CollisionSystem::SyncProxies(entities, view, tracker);
+        ok = AssertTrue(tracker.Update(began, ended) && HasPair(ended, 1, 2) && began.size() == 1 && HasPair(began, 2, 3),
+                        "Contact ends and another begins") && ok;
+
+        // Removal ends the contacts of the entity
+        tracker.RemoveBox(3);
+        ok = AssertTrue(tracker.Update(began, ended) && HasPair(ended, 2, 3) && tracker.GetContacts().empty(),
+                        "Removed box ends its contacts") && ok;
+
+        // An invalid box removes the proxy once, then is ignored
+        positions.GetComponent(1).position.x = 200.0f;
+        boxes.GetComponent(2).boundingBox.w = -1.0f;
+        entities.erase(3);
+        CollisionSystem::SyncProxies(entities, view, tracker);
+        ok = AssertTrue(tracker.Update(began, ended) && began.empty() && tracker.GetProxyCount() == 1,
+                        "Invalid box removes the proxy") && ok;
+        ok = AssertTrue(CollisionSystem::SyncProxies(entities, view, tracker) == 0, "Invalid box is not queued again") && ok;
+    }
+
+    {
+        // Contacts maintained from the broad phase deltas match a brute-force narrow phase,
+        // contact data included, while a few boxes move or leave every frame
+        std::vector<Olympe::Collision_AABB> boxes(120);
+        unsigned int state = 17u;
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            boxes[i].min.x = NextUnit(state) * 60.0f;
+            boxes[i].min.y = NextUnit(state) * 60.0f;
+            boxes[i].max.x = boxes[i].min.x + 2.0f + NextUnit(state) * 4.0f;
+            boxes[i].max.y = boxes[i].min.y + 2.0f + NextUnit(state) * 4.0f;
+        }
+
+        Olympe::Collision_ContactTracker tracker;
+        std::vector<Olympe::Collision_Contact> began, ended, previous, expected;
+        bool matches = true;
+        bool reportsChanges = true;
+        size_t changes = 0;
+        for (int frame = 0; frame < 30; ++frame)
+        {
+            for (size_t i = 0; i < boxes.size(); ++i)
+            {
+                const EntityID entity = static_cast<EntityID>(i + 1);
+                if ((i % 11) == static_cast<size_t>(frame % 11))
+                {
+                    tracker.RemoveBox(entity);
+                    continue;
+                }
+                if ((i % 3) == static_cast<size_t>(frame % 3))
+                {
+                    const float dx = (NextUnit(state) - 0.5f) * 2.0f;
+                    const float dy = (NextUnit(state) - 0.5f) * 2.0f;
+                    boxes[i].min.x += dx;
+                    boxes[i].max.x += dx;
+                    boxes[i].min.y += dy;
+                    boxes[i].max.y += dy;
+                }
+                tracker.SetBox(entity, boxes[i]);
+            }
+            tracker.Update(began, ended);
+
+            expected.clear();
+            for (size_t i = 0; i < boxes.size(); ++i)
+            {
+                for (size_t j = i + 1; j < boxes.size(); ++j)
+                {
+                    if ((i % 11) == static_cast<size_t>(frame % 11) || (j % 11) == static_cast<size_t>(frame % 11))
+                        continue;
+                    Olympe::Collision_Contact contact;
+                    contact.a = static_cast<EntityID>(i + 1);
+                    contact.b = static_cast<EntityID>(j + 1);
+                    if (Olympe::Collision_ComputeContact_AABBAABB(boxes[i], boxes[j], contact.result))
+                        expected.push_back(contact);
+                }
+            }
+
+            const std::vector<Olympe::Collision_Contact>& contacts = tracker.GetContacts();
+            matches = matches && SameContacts(contacts, expected);
+
+            // began/ended are the difference with the previous frame
+            for (const Olympe::Collision_Contact& contact : began)
+                reportsChanges = reportsChanges && HasPair(contacts, contact.a, contact.b) && !HasPair(previous, contact.a, contact.b);
+            for (const Olympe::Collision_Contact& contact : ended)
+                reportsChanges = reportsChanges && !HasPair(contacts, contact.a, contact.b) && HasPair(previous, contact.a, contact.b);
+            reportsChanges = reportsChanges && previous.size() + began.size() - ended.size() == contacts.size();
+            changes += began.size() + ended.size();
+            previous = contacts;
+        }
+
+        ok = AssertTrue(matches, "Delta contacts match the brute-force narrow phase") && ok;
+        ok = AssertTrue(reportsChanges && changes > 0, "Began/ended are the contact changes") && ok;
+    }
+
+    if (!ok)
+    {
+        std::cerr << "[CollisionContactTest] FAIL" << std::endl;
+        return 1;
+    }
+
+    std::cout << "[CollisionContactTest] PASS" << std::endl;
+    return 0;
+}
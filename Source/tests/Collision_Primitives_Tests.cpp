@@ -1,7 +1,10 @@
 #include "../CollisionSystems/Collision_Primitives.h"
 #include "../CollisionSystems/Collision_Intersections.h"
+#include "../CollisionSystems/Collision_BatchIntersections.h"
 
+#include <cstdint>
 #include <iostream>
+#include <vector>
 
 static bool AssertTrue(bool condition, const char* label)
 {
@@ -13,6 +16,115 @@ static bool AssertTrue(bool condition, const char* label)
     return true;
 }
 
+// Quarter-unit grid: many shapes touch exactly, or within the epsilon
+static float NextGridValue(unsigned int& state, float range)
+{
+    state = state * 1664525u + 1013904223u;
+    return static_cast<float>((state >> 8) % static_cast<unsigned int>(range * 4.0f)) * 0.25f - range * 0.5f;
+}
+
+static Olympe::Collision_AABB MakeBox(float minX, float minY, float maxX, float maxY)
+{
+    Olympe::Collision_AABB box;
+    box.min.x = minX; box.min.y = minY;
+    box.max.x = maxX; box.max.y = maxY;
+    return box;
+}
+
+static Olympe::Collision_Circle MakeCircle(float x, float y, float radius)
+{
+    Olympe::Collision_Circle circle;
+    circle.center.x = x;
+    circle.center.y = y;
+    circle.radius = radius;
+    return circle;
+}
+
+// Validity without the scalar functions' log: invalid shapes never intersect
+static bool IsValidBox(const Olympe::Collision_AABB& box)
+{
+    return box.min.x <= box.max.x && box.min.y <= box.max.y && box.min.z <= box.max.z;
+}
+
+static bool IsValidCircle(const Olympe::Collision_Circle& circle)
+{
+    return circle.radius >= 0.0f;
+}
+
+// Batch masks and penetrations against the scalar functions, shape by shape. The scalar
+// functions are only called on valid pairs: they log every invalid shape they are given.
+static bool CheckBatchAgainstScalar(const std::vector<Olympe::Collision_AABB>& boxes,
+                                    const std::vector<Olympe::Collision_Circle>& circles)
+{
+    Olympe::Collision_PackedAABBs packedBoxes;
+    for (const Olympe::Collision_AABB& box : boxes)
+        packedBoxes.Push(box);
+    Olympe::Collision_PackedCircles packedCircles;
+    for (const Olympe::Collision_Circle& circle : circles)
+        packedCircles.Push(circle);
+
+    std::vector<uint64_t> mask(Olympe::Collision_BatchMaskWordCount(boxes.size() + circles.size()), ~0ull);
+    std::vector<float> penetration(boxes.size() + circles.size(), -1.0f);
+    bool ok = true;
+
+    for (const Olympe::Collision_AABB& query : boxes)
+    {
+        size_t hits = Olympe::Collision_BatchIntersects_AABBAABB(query, packedBoxes, &mask[0], &penetration[0]);
+        size_t expectedHits = 0;
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            Olympe::Collision_ContactResult contact;
+            const bool expected = IsValidBox(query) && IsValidBox(boxes[i]) &&
+                                  Olympe::Collision_ComputeContact_AABBAABB(query, boxes[i], contact);
+            expectedHits += expected ? 1 : 0;
+            ok = ok && Olympe::Collision_BatchMaskTest(&mask[0], i) == expected &&
+                 penetration[i] == (expected ? contact.penetration : 0.0f);
+        }
+        ok = ok && hits == expectedHits;
+
+        hits = Olympe::Collision_BatchIntersects_AABBCircle(query, packedCircles, &mask[0], &penetration[0]);
+        expectedHits = 0;
+        for (size_t i = 0; i < circles.size(); ++i)
+        {
+            const bool expected = IsValidCircle(circles[i]) && IsValidBox(query) &&
+                                  Olympe::Collision_Intersects_CircleAABB(circles[i], query);
+            expectedHits += expected ? 1 : 0;
+            ok = ok && Olympe::Collision_BatchMaskTest(&mask[0], i) == expected &&
+                 (expected ? penetration[i] >= 0.0f && penetration[i] <= circles[i].radius : penetration[i] == 0.0f);
+        }
+        ok = ok && hits == expectedHits;
+    }
+
+    for (const Olympe::Collision_Circle& query : circles)
+    {
+        size_t hits = Olympe::Collision_BatchIntersects_CircleAABB(query, packedBoxes, &mask[0], &penetration[0]);
+        size_t expectedHits = 0;
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            const bool expected = IsValidCircle(query) && IsValidBox(boxes[i]) &&
+                                  Olympe::Collision_Intersects_CircleAABB(query, boxes[i]);
+            expectedHits += expected ? 1 : 0;
+            ok = ok && Olympe::Collision_BatchMaskTest(&mask[0], i) == expected &&
+                 (expected ? penetration[i] >= 0.0f && penetration[i] <= query.radius : penetration[i] == 0.0f);
+        }
+        ok = ok && hits == expectedHits;
+
+        // Without the penetration output
+        hits = Olympe::Collision_BatchIntersects_CircleCircle(query, packedCircles, &mask[0], 0);
+        expectedHits = 0;
+        for (size_t i = 0; i < circles.size(); ++i)
+        {
+            const bool expected = IsValidCircle(query) && IsValidCircle(circles[i]) &&
+                                  Olympe::Collision_Intersects_CircleCircle(query, circles[i]);
+            expectedHits += expected ? 1 : 0;
+            ok = ok && Olympe::Collision_BatchMaskTest(&mask[0], i) == expected;
+        }
+        ok = ok && hits == expectedHits;
+    }
+
+    return ok;
+}
+
 int main()
 {
     bool ok = true;
@@ -98,6 +210,86 @@ int main()
                         "ToWorldAABB values") && ok;
     }
 
+    {
+        Olympe::Collision_AABB a;
+        a.min.x = 0.0f; a.min.y = 0.0f;
+        a.max.x = 4.0f; a.max.y = 4.0f;
+
+        Olympe::Collision_AABB b;
+        b.min.x = 3.0f; b.min.y = 1.0f;
+        b.max.x = 7.0f; b.max.y = 3.0f;
+
+        Olympe::Collision_ContactResult contact;
+        ok = AssertTrue(Olympe::Collision_ComputeContact_AABBAABB(a, b, contact) && contact.intersects,
+                        "ContactAABB overlap") && ok;
+        ok = AssertTrue(contact.normal.x == 1.0f && contact.normal.y == 0.0f && contact.penetration == 1.0f,
+                        "ContactAABB normal along the shallow axis, from a to b") && ok;
+        ok = AssertTrue(contact.point.x == 3.5f && contact.point.y == 2.0f, "ContactAABB point") && ok;
+
+        ok = AssertTrue(Olympe::Collision_ComputeContact_AABBAABB(b, a, contact) && contact.normal.x == -1.0f,
+                        "ContactAABB reversed normal") && ok;
+
+        b.min.x = 1.0f; b.min.y = 3.5f;
+        b.max.x = 3.0f; b.max.y = 9.0f;
+        ok = AssertTrue(Olympe::Collision_ComputeContact_AABBAABB(a, b, contact) &&
+                        contact.normal.y == 1.0f && contact.penetration == 0.5f,
+                        "ContactAABB vertical") && ok;
+
+        b.min.x = 5.0f; b.max.x = 6.0f;
+        ok = AssertTrue(!Olympe::Collision_ComputeContact_AABBAABB(a, b, contact) && !contact.intersects,
+                        "ContactAABB separated") && ok;
+    }
+
+    {
+        // The shapes of the tests above, plus invalid ones
+        std::vector<Olympe::Collision_AABB> boxes;
+        boxes.push_back(MakeBox(-1.0f, -1.0f, 1.0f, 1.0f));
+        boxes.push_back(MakeBox(0.0f, 0.0f, 2.0f, 2.0f));
+        boxes.push_back(MakeBox(2.0f, 2.0f, 4.0f, 4.0f));
+        boxes.push_back(MakeBox(0.0f, 0.0f, 4.0f, 4.0f));
+        boxes.push_back(MakeBox(3.0f, 1.0f, 7.0f, 3.0f));
+        boxes.push_back(MakeBox(1.0f, 3.5f, 3.0f, 9.0f));
+        boxes.push_back(MakeBox(5.0f, 3.5f, 6.0f, 9.0f));
+        boxes.push_back(MakeBox(4.00005f, 0.0f, 5.0f, 1.0f));
+        boxes.push_back(MakeBox(2.0f, 0.0f, 1.0f, 1.0f));
+        Olympe::Collision_AABB badZ = MakeBox(0.0f, 0.0f, 1.0f, 1.0f);
+        badZ.min.z = 1.0f;
+        boxes.push_back(badZ);
+
+        std::vector<Olympe::Collision_Circle> circles;
+        circles.push_back(MakeCircle(0.0f, 0.0f, 5.0f));
+        circles.push_back(MakeCircle(0.0f, 0.0f, 4.0f));
+        circles.push_back(MakeCircle(7.0f, 0.0f, 3.0f));
+        circles.push_back(MakeCircle(2.0f, 0.0f, 1.1f));
+        circles.push_back(MakeCircle(3.0f, 4.0f, 0.0f));
+        circles.push_back(MakeCircle(1.0f, 1.0f, -1.0f));
+
+        ok = AssertTrue(CheckBatchAgainstScalar(boxes, circles), "Batch matches scalar on the unit shapes") && ok;
+
+        // Lane counts that are not multiples of 4 or 8
+        unsigned int state = 7u;
+        for (size_t i = 0; i < 61; ++i)
+        {
+            const float x = NextGridValue(state, 16.0f);
+            const float y = NextGridValue(state, 16.0f);
+            boxes.push_back(MakeBox(x, y, x + 0.25f + NextGridValue(state, 8.0f) + 4.0f, y + NextGridValue(state, 8.0f) + 4.0f));
+            circles.push_back(MakeCircle(NextGridValue(state, 16.0f), NextGridValue(state, 16.0f), NextGridValue(state, 6.0f) + 2.0f));
+        }
+        ok = AssertTrue(CheckBatchAgainstScalar(boxes, circles), "Batch matches scalar on random shapes") && ok;
+
+        Olympe::Collision_PackedCircles packed;
+        packed.Push(MakeCircle(6.0f, 0.0f, 3.0f));
+        packed.Push(MakeCircle(8.0f, 0.0f, 3.0f));
+        uint64_t mask = 0;
+        float penetration[2] = { -1.0f, -1.0f };
+        ok = AssertTrue(Olympe::Collision_BatchIntersects_CircleCircle(MakeCircle(0.0f, 0.0f, 4.0f), packed, &mask, penetration) == 1 &&
+                        mask == 1u && penetration[0] == 1.0f && penetration[1] == 0.0f,
+                        "BatchCircleCircle penetration") && ok;
+        ok = AssertTrue(Olympe::Collision_BatchIntersects_CircleCircle(MakeCircle(0.0f, 0.0f, -4.0f), packed, &mask, penetration) == 0 &&
+                        mask == 0 && penetration[0] == 0.0f,
+                        "Batch invalid query") && ok;
+    }
+
     if (!ok)
     {
         std::cerr << "[CollisionTest] FAIL" << std::endl;
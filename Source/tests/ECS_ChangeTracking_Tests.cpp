@@ -0,0 +1,135 @@
+#include "../ECS_SoA.h"
+#include "../ECS_View.h"
+
+#include <iostream>
+#include <vector>
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[ECSChangeTrackingTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+template <typename Range>
+static std::vector<EntityID> Collect(const Range& range)
+{
+    std::vector<EntityID> result;
+    for (EntityID entity : range)
+        result.push_back(entity);
+    return result;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        // Insertion stamps the current tick, swap-and-pop carries stamps along
+        ComponentPool<Position_data> pool;
+        const ChangeTick first = GetChangeTick();
+        pool.AddComponent(1);
+        pool.AddComponent(2);
+        AdvanceChangeTick();
+        pool.AddComponent(3);
+        ok = AssertTrue(pool.GetChangedTick(1) == first && pool.GetChangedTick(3) == first + 1, "Add stamps tick") && ok;
+
+        pool.RemoveComponent(1);
+        ok = AssertTrue(pool.GetChangedTick(3) == first + 1 && pool.GetChangedTick(2) == first, "Swap-and-pop keeps stamps") && ok;
+        ok = AssertTrue(pool.GetChangedTick(1) == 0, "Missing component has tick 0") && ok;
+
+        AdvanceChangeTick();
+        pool.GetComponent(2).position.x = 5.0f;
+        ok = AssertTrue(pool.GetChangedTick(2) == first, "GetComponent does not stamp") && ok;
+        pool.Modify(2).position.x = 6.0f;
+        ok = AssertTrue(pool.GetChangedTick(2) == GetChangeTick(), "Modify stamps") && ok;
+    }
+
+    {
+        // Changed<T>() only visits written entities
+        ComponentPool<Position_data> positions;
+        ComponentPool<Movement_data> movements;
+        EntitySet entities;
+        for (EntityID e = 1; e <= 10; ++e)
+        {
+            positions.AddComponent(e);
+            movements.AddComponent(e);
+            entities.insert(e);
+        }
+
+        AdvanceChangeTick();
+        AdvanceChangeTick();
+        const ChangeTick since = GetChangeTick();
+        ComponentView<Position_data, Movement_data> view(entities, &positions, &movements);
+        ok = AssertTrue(Collect(view.Changed<Position_data>(since)).empty(), "Nothing changed yet") && ok;
+        ok = AssertTrue(Collect(view.Changed<Position_data>()).empty(), "Default window excludes old writes") && ok;
+
+        view.Modify<Position_data>(4).position.y = 1.0f;
+        positions.MarkChanged(9);
+        movements.Modify(2);
+
+        const std::vector<EntityID> changed = Collect(view.Changed<Position_data>(since));
+        ok = AssertTrue(changed.size() == 2 && changed[0] == 4 && changed[1] == 9, "Changed range") && ok;
+        ok = AssertTrue(Collect(view.Changed<Movement_data>(since)).size() == 1, "Per component stamps") && ok;
+
+        size_t visited = 0;
+        view.Changed<Position_data>().Each([&](EntityID e, Position_data& pos, Movement_data&)
+            {
+                visited += (e == 4 && pos.position.y == 1.0f) ? 1 : 0;
+                visited += (e == 9) ? 1 : 0;
+            });
+        ok = AssertTrue(visited == 2, "Changed Each passes components") && ok;
+
+        AdvanceChangeTick();
+        ok = AssertTrue(Collect(view.Changed<Position_data>()).size() == 2, "Previous frame still in default window") && ok;
+        AdvanceChangeTick();
+        ok = AssertTrue(Collect(view.Changed<Position_data>()).empty(), "Window moves with the frame") && ok;
+    }
+
+    {
+        // SoA scatter stamps only the entities that actually moved
+        ComponentPool<Position_data> positions;
+        ComponentPool<Movement_data> movements;
+        SoALanes<Position_data> positionLanes;
+        SoALanes<Movement_data> movementLanes;
+        EntitySet entities;
+        for (EntityID e = 1; e <= 37; ++e)
+        {
+            Movement_data move;
+            move.velocity = (e % 3 == 0) ? Vector(10.0f, 0.0f, 0.0f) : Vector(0.0f, 0.0f, 0.0f);
+            positions.AddComponent(e, Position_data(Vector(static_cast<float>(e), 0.0f, 0.0f)));
+            movements.AddComponent(e, move);
+            entities.insert(e);
+        }
+
+        AdvanceChangeTick();
+        AdvanceChangeTick();
+        const ChangeTick since = GetChangeTick();
+
+        positionLanes.Resize(entities.size());
+        movementLanes.Resize(entities.size());
+        positionLanes.Gather(positions, entities.data(), 0, entities.size());
+        movementLanes.Gather(movements, entities.data(), 0, entities.size());
+        for (size_t lane = 0; lane < 3; ++lane)
+            SoAKernels::Integrate(positionLanes.Lane(lane), movementLanes.Lane(lane), 0.5f, 0, entities.size());
+        positionLanes.Scatter(positions, 0, entities.size());
+
+        ComponentView<Position_data, Movement_data> view(entities, &positions, &movements);
+        const std::vector<EntityID> moved = Collect(view.Changed<Position_data>(since));
+        bool onlyMovers = moved.size() == 12;
+        for (EntityID e : moved)
+            onlyMovers = onlyMovers && (e % 3 == 0) && positions.GetComponent(e).position.x == e + 5.0f;
+        ok = AssertTrue(onlyMovers, "Scatter stamps moved entities only") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[ECSChangeTrackingTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
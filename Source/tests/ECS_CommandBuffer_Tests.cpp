@@ -0,0 +1,83 @@
+#include "../ECS_CommandBuffer.h"
+#include "../system/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[ECSCommandBufferTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        EntityCommandBuffer buffer;
+        buffer.DestroyEntity(3);
+        buffer.CreateEntity([](EntityID) {});
+        ok = AssertTrue(!buffer.empty() && buffer.GetPendingDestroyCount() == 1 && buffer.GetPendingCreateCount() == 1,
+                        "Commands recorded") && ok;
+
+        std::vector<EntityCommandBuffer::CreateCallback> creates;
+        std::vector<EntityID> destroys;
+        buffer.TakeCommands(creates, destroys);
+        ok = AssertTrue(buffer.empty() && creates.size() == 1 && destroys.size() == 1 && destroys[0] == 3,
+                        "TakeCommands empties the buffer") && ok;
+    }
+
+    JobSystem::Get().Initialize(3);
+
+    {
+        // Many jobs recording into one buffer at the same time
+        const size_t count = 20000;
+        EntityCommandBuffer buffer;
+        std::atomic<size_t> createdCount(0);
+        for (int frame = 0; frame < 10; ++frame)
+        {
+            JobSystem::Get().ParallelFor(count, 16, [&buffer, &createdCount](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    buffer.DestroyEntity(static_cast<EntityID>(i + 1));
+                    if ((i % 4) == 0)
+                        buffer.CreateEntity([&createdCount](EntityID) { ++createdCount; });
+                }
+            });
+        }
+
+        std::vector<EntityCommandBuffer::CreateCallback> creates;
+        std::vector<EntityID> destroys;
+        buffer.TakeCommands(creates, destroys);
+        for (const EntityCommandBuffer::CreateCallback& onCreated : creates)
+            onCreated(INVALID_ENTITY_ID);
+
+        // Every recorded destroy is there, ten times (once per frame)
+        std::sort(destroys.begin(), destroys.end());
+        bool allRecorded = destroys.size() == count * 10;
+        for (size_t i = 0; allRecorded && i < destroys.size(); ++i)
+            allRecorded = destroys[i] == static_cast<EntityID>(i / 10 + 1);
+
+        ok = AssertTrue(allRecorded, "No destroy lost or duplicated") && ok;
+        ok = AssertTrue(creates.size() == count / 4 * 10 && createdCount == count / 4 * 10, "No create lost or duplicated") && ok;
+    }
+
+    JobSystem::Get().Shutdown();
+
+    if (!ok)
+    {
+        std::cerr << "[ECSCommandBufferTest] FAIL" << std::endl;
+        return 1;
+    }
+
+    std::cout << "[ECSCommandBufferTest] PASS" << std::endl;
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include "../ECS_Register.h"
+
+#include <iostream>
+
+struct PoolTestComponent
+{
+    int value = 0;
+
+    PoolTestComponent() = default;
+    explicit PoolTestComponent(int v) : value(v) {}
+};
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[ECSComponentPoolTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        ComponentPool<PoolTestComponent> pool;
+        pool.AddComponent(1, 10);
+        pool.AddComponent(2, 20);
+        pool.AddComponent(3, 30);
+
+        ok = AssertTrue(pool.Size() == 3, "Add three components") && ok;
+        ok = AssertTrue(pool.HasComponent(2), "HasComponent after add") && ok;
+        ok = AssertTrue(!pool.HasComponent(4), "HasComponent on missing entity") && ok;
+        ok = AssertTrue(pool.GetComponent(3).value == 30, "GetComponent value") && ok;
+
+        // Duplicate add is ignored
+        pool.AddComponent(2, 99);
+        ok = AssertTrue(pool.Size() == 3 && pool.GetComponent(2).value == 20, "Duplicate add ignored") && ok;
+    }
+
+    {
+        ComponentPool<PoolTestComponent> pool;
+        pool.AddComponent(1, 10);
+        pool.AddComponent(2, 20);
+        pool.AddComponent(3, 30);
+
+        // Removing the first slot moves the last component into it
+        pool.RemoveComponent(1);
+        ok = AssertTrue(pool.Size() == 2, "Remove keeps pool dense") && ok;
+        ok = AssertTrue(!pool.HasComponent(1), "Removed entity is gone") && ok;
+        ok = AssertTrue(pool.m_indexToEntity[0] == 3 && pool.m_data[0].value == 30, "Swap-and-pop moved last slot") && ok;
+        ok = AssertTrue(pool.GetComponent(3).value == 30 && pool.GetComponent(2).value == 20, "Lookups valid after swap") && ok;
+
+        pool.RemoveComponent(1);
+        ok = AssertTrue(pool.Size() == 2, "Removing twice is a no-op") && ok;
+        ok = AssertTrue(pool.TryGetComponent(1) == nullptr, "TryGetComponent on removed entity") && ok;
+    }
+
+    {
+        // Indices far apart land on separate sparse pages
+        ComponentPool<PoolTestComponent> pool;
+        pool.AddComponent(5, 5);
+        pool.AddComponent(50000, 7);
+        ok = AssertTrue(pool.GetComponent(50000).value == 7, "Sparse page allocated on demand") && ok;
+        ok = AssertTrue(!pool.HasComponent(49999), "Neighbour slot on fresh page is empty") && ok;
+        ok = AssertTrue(!pool.HasComponent(900000), "Index past last page") && ok;
+
+        bool threw = false;
+        try
+        {
+            pool.GetComponent(6);
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        ok = AssertTrue(threw, "GetComponent throws on missing entity") && ok;
+    }
+
+    {
+        // Generational handles: same index, different generation
+        const EntityID original = MakeEntityID(42, 3);
+        const EntityID recycled = MakeEntityID(42, 4);
+        ok = AssertTrue(GetEntityIndex(original) == 42 && GetEntityGeneration(original) == 3, "Handle round-trip") && ok;
+        ok = AssertTrue(GetEntityIndex(recycled) == GetEntityIndex(original) && original != recycled, "Recycled handle differs") && ok;
+        ok = AssertTrue(GetEntityGeneration(MakeEntityID(1, ENTITY_GENERATION_MASK + 1)) == 0, "Generation wraps") && ok;
+
+        ComponentPool<PoolTestComponent> pool;
+        pool.AddComponent(original, 1);
+        ok = AssertTrue(!pool.HasComponent(recycled), "Stale generation rejected by pool") && ok;
+
+        pool.RemoveComponent(recycled);
+        ok = AssertTrue(pool.HasComponent(original), "Remove with stale handle is a no-op") && ok;
+
+        pool.RemoveComponent(original);
+        pool.AddComponent(recycled, 2);
+        ok = AssertTrue(!pool.HasComponent(original) && pool.GetComponent(recycled).value == 2, "Slot reused by new generation") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[ECSComponentPoolTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,72 @@
+#include "../ECS_Entity.h"
+
+#include <iostream>
+#include <unordered_set>
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[ECSEntityHandleTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        EntityHandleAllocator handles;
+        const EntityID a = handles.Allocate();
+        const EntityID b = handles.Allocate();
+        ok = AssertTrue(a != INVALID_ENTITY_ID && GetEntityIndex(a) == 1 && GetEntityIndex(b) == 2,
+                        "Index 0 is reserved") && ok;
+        ok = AssertTrue(!handles.IsValid(INVALID_ENTITY_ID), "INVALID_ENTITY_ID is never valid") && ok;
+
+        ok = AssertTrue(handles.Release(a) && !handles.IsValid(a) && !handles.Release(a),
+                        "Released handle is stale") && ok;
+
+        // FIFO: index 1 is reused with the next generation
+        const EntityID c = handles.Allocate();
+        ok = AssertTrue(GetEntityIndex(c) == 1 && GetEntityGeneration(c) == 1 && !handles.IsValid(a) && handles.IsValid(c),
+                        "Recycled slot bumps the generation") && ok;
+    }
+
+    {
+        // One slot churned past all of its generations
+        EntityHandleAllocator handles;
+        const EntityID first = handles.Allocate();
+        std::unordered_set<EntityID> issued;
+        issued.insert(first);
+
+        EntityID current = first;
+        bool allUnique = true;
+        bool staleRejected = true;
+        for (std::uint32_t reuse = 0; reuse < ENTITY_GENERATION_MASK + 100; ++reuse)
+        {
+            handles.Release(current);
+            current = handles.Allocate();
+            allUnique = issued.insert(current).second && allUnique;
+            staleRejected = !handles.IsValid(first) && staleRejected;
+        }
+
+        ok = AssertTrue(allUnique, "No handle is issued twice") && ok;
+        ok = AssertTrue(staleRejected && !handles.IsValid(first), "The first handle never validates again") && ok;
+        ok = AssertTrue(handles.GetRetiredCount() == 1, "Slot retired when its generation is exhausted") && ok;
+        ok = AssertTrue(GetEntityIndex(current) == 2 && GetEntityGeneration(current) == 99,
+                        "Churn continues on a new slot") && ok;
+        ok = AssertTrue(!handles.IsValid(MakeEntityID(1, ENTITY_GENERATION_MASK)) &&
+                        !handles.IsValid(MakeEntityID(1, 0)),
+                        "Retired slot rejects every generation") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[ECSEntityHandleTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,146 @@
+#include "../ECS_Scheduler.h"
+#include "../system/JobSystem.h"
+
+#include <atomic>
+#include <iostream>
+
+struct SchedulerTestA {};
+struct SchedulerTestB {};
+struct SchedulerTestC {};
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[ECSSchedulerTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Records the order in which systems complete
+static std::atomic<int> g_sequence(0);
+
+// Throws something that is not a std::exception
+class ThrowingSystem : public ECS_System
+{
+public:
+    ThrowingSystem() { Writes<SchedulerTestA>(); }
+    void Process() override { throw 42; }
+};
+
+class RecordingSystem : public ECS_System
+{
+public:
+    int finishedAt = -1;
+    int runCount = 0;
+
+    template <typename T> RecordingSystem& Read() { Reads<T>(); return *this; }
+    template <typename T> RecordingSystem& Write() { Writes<T>(); return *this; }
+    RecordingSystem& NoAccess() { DeclareNoComponentAccess(); return *this; }
+
+    void Process() override
+    {
+        ++runCount;
+        finishedAt = g_sequence++;
+    }
+};
+
+int main()
+{
+    bool ok = true;
+
+    {
+        RecordingSystem readerA, writerA, writerB, undeclared, none;
+        readerA.Read<SchedulerTestA>();
+        writerA.Write<SchedulerTestA>();
+        writerB.Write<SchedulerTestB>().Read<SchedulerTestC>();
+        none.NoAccess();
+
+        ok = AssertTrue(ECS_Scheduler::Conflicts(readerA, writerA), "Read/write conflict") && ok;
+        ok = AssertTrue(ECS_Scheduler::Conflicts(writerA, writerA), "Write/write conflict") && ok;
+        ok = AssertTrue(!ECS_Scheduler::Conflicts(readerA, readerA), "Read/read is shared") && ok;
+        ok = AssertTrue(!ECS_Scheduler::Conflicts(writerA, writerB), "Disjoint writes") && ok;
+        ok = AssertTrue(ECS_Scheduler::Conflicts(undeclared, none), "Undeclared is exclusive") && ok;
+        ok = AssertTrue(!ECS_Scheduler::Conflicts(none, writerA), "No access conflicts with nothing") && ok;
+    }
+
+    JobSystem::Get().Initialize(3);
+
+    {
+        // writeA -> readA (depends), writeB independent, exclusive barrier, then readA2
+        std::vector<std::unique_ptr<ECS_System>> systems;
+        RecordingSystem* writeA = new RecordingSystem();
+        RecordingSystem* readA = new RecordingSystem();
+        RecordingSystem* writeB = new RecordingSystem();
+        RecordingSystem* barrier = new RecordingSystem();
+        RecordingSystem* readA2 = new RecordingSystem();
+        writeA->Write<SchedulerTestA>();
+        readA->Read<SchedulerTestA>().Write<SchedulerTestC>();
+        writeB->Write<SchedulerTestB>();
+        readA2->Read<SchedulerTestA>();
+        systems.emplace_back(writeA);
+        systems.emplace_back(readA);
+        systems.emplace_back(writeB);
+        systems.emplace_back(barrier);
+        systems.emplace_back(readA2);
+
+        ECS_Scheduler scheduler;
+        bool orderOk = true;
+        for (int frame = 0; frame < 50; ++frame)
+        {
+            scheduler.Run(systems);
+            orderOk = orderOk
+                && writeA->finishedAt < readA->finishedAt
+                && writeA->finishedAt < barrier->finishedAt
+                && readA->finishedAt < barrier->finishedAt
+                && writeB->finishedAt < barrier->finishedAt
+                && barrier->finishedAt < readA2->finishedAt;
+        }
+
+        ok = AssertTrue(orderOk, "Dependencies respected every frame") && ok;
+        ok = AssertTrue(writeA->runCount == 50 && readA2->runCount == 50 && barrier->runCount == 50, "Each system runs once per frame") && ok;
+        ok = AssertTrue(scheduler.GetCriticalPathLength() == 4, "Critical path: writeA, readA, barrier, readA2") && ok;
+    }
+
+    {
+        // A throwing worker system (non-std exception) does not stall the frame
+        std::vector<std::unique_ptr<ECS_System>> systems;
+        ThrowingSystem* thrower = new ThrowingSystem();
+        RecordingSystem* after = new RecordingSystem();
+        after->Read<SchedulerTestA>();
+        systems.emplace_back(thrower);
+        systems.emplace_back(after);
+
+        ECS_Scheduler scheduler;
+        for (int frame = 0; frame < 10; ++frame)
+            scheduler.Run(systems);
+        ok = AssertTrue(after->runCount == 10, "Frame completes after a non-std exception") && ok;
+    }
+
+    JobSystem::Get().Shutdown();
+
+    {
+        // Without workers everything runs on the calling thread
+        std::vector<std::unique_ptr<ECS_System>> systems;
+        RecordingSystem* a = new RecordingSystem();
+        RecordingSystem* b = new RecordingSystem();
+        a->Write<SchedulerTestA>();
+        b->Write<SchedulerTestB>();
+        systems.emplace_back(a);
+        systems.emplace_back(b);
+
+        ECS_Scheduler scheduler;
+        scheduler.Run(systems);
+        ok = AssertTrue(a->runCount == 1 && b->runCount == 1, "Runs without worker threads") && ok;
+        ok = AssertTrue(scheduler.GetCriticalPathLength() == 1, "Independent systems share one level") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[ECSSchedulerTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,123 @@
+#include "../ECS_Entity.h"
+
+#include <iostream>
+
+struct SignatureTestA {};
+struct SignatureTestB {};
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[ECSSignatureTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Reference implementation of the match test used before the SIMD path
+static bool ScalarContains(const ComponentSignature& signature, const ComponentSignature& required)
+{
+    for (std::size_t bit = 0; bit < MAX_COMPONENTS; ++bit)
+    {
+        if (required.test(bit) && !signature.test(bit))
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        // Type IDs start at bit 0 so no signature bit is wasted
+        const ComponentTypeID a = GetComponentTypeID_Static<SignatureTestA>();
+        const ComponentTypeID b = GetComponentTypeID_Static<SignatureTestB>();
+        ok = AssertTrue(a == 0 && b == 1, "Type IDs start at 0") && ok;
+        ok = AssertTrue(GetComponentTypeID_Static<SignatureTestA>() == a, "Type ID is stable") && ok;
+    }
+
+    {
+        ComponentSignature sig;
+        ok = AssertTrue(sig.none() && !sig.any() && sig.count() == 0, "Default signature is empty") && ok;
+
+        sig.set(0).set(63).set(64).set(MAX_COMPONENTS - 1);
+        ok = AssertTrue(sig.test(0) && sig.test(63) && sig.test(64) && sig.test(MAX_COMPONENTS - 1), "Bits across both words") && ok;
+        ok = AssertTrue(!sig.test(1) && !sig.test(65) && sig.count() == 4, "Unset bits and count") && ok;
+
+        sig.set(63, false);
+        sig.reset(64);
+        ok = AssertTrue(!sig.test(63) && !sig.test(64) && sig.count() == 2, "Clear single bits") && ok;
+
+        sig.reset();
+        ok = AssertTrue(sig.none(), "Reset all") && ok;
+    }
+
+    {
+        // Contains() must agree with the bit-by-bit reference on mixed patterns
+        bool allMatch = true;
+        std::uint32_t seed = 12345u;
+        for (int i = 0; i < 2000; ++i)
+        {
+            ComponentSignature entity;
+            ComponentSignature required;
+            for (std::size_t bit = 0; bit < MAX_COMPONENTS; ++bit)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                if ((seed >> 28) < 6) entity.set(bit);
+                if ((seed >> 24 & 0xF) < 1) required.set(bit);
+            }
+            if (i % 3 == 0)
+                entity |= required;
+
+            const bool expected = ScalarContains(entity, required);
+            allMatch = allMatch
+                && entity.Contains(required) == expected
+                && ((entity & required) == required) == expected;
+        }
+        ok = AssertTrue(allMatch, "Contains matches scalar reference") && ok;
+
+        ComponentSignature empty;
+        ComponentSignature high;
+        high.set(100);
+        ok = AssertTrue(high.Contains(empty) && !empty.Contains(high), "Empty requirement always matches") && ok;
+        ok = AssertTrue(high != empty && (high & empty) == empty, "Equality operators") && ok;
+
+        ComponentSignature low;
+        low.set(3);
+        ComponentSignature both = low | high;
+        ok = AssertTrue(both.Intersects(high) && both.Intersects(low) && !low.Intersects(high), "Intersects") && ok;
+        ok = AssertTrue(!both.Intersects(empty), "Nothing intersects the empty signature") && ok;
+
+        bool threw = false;
+        try
+        {
+            both.set(MAX_COMPONENTS);
+        }
+        catch (const std::out_of_range&)
+        {
+            threw = true;
+        }
+        ok = AssertTrue(threw && both == (low | high), "set() out of range throws and leaves the signature unchanged") && ok;
+
+        threw = false;
+        try
+        {
+            both.reset(MAX_COMPONENTS + 64);
+        }
+        catch (const std::out_of_range&)
+        {
+            threw = true;
+        }
+        ok = AssertTrue(threw && !both.test(MAX_COMPONENTS), "reset() out of range throws, test() is false") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[ECSSignatureTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,99 @@
+#include "../ECS_SoA.h"
+#include "../ECS_View.h"
+
+#include <cstring>
+#include <iostream>
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[ECSSoATest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static std::uint32_t g_seed = 0x1234567u;
+static float NextFloat(float range)
+{
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (static_cast<float>(g_seed >> 8) / 16777216.0f * 2.0f - 1.0f) * range;
+}
+
+static bool SameBits(float a, float b)
+{
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+int main()
+{
+    bool ok = true;
+
+    static_assert(ComponentLayout<Position_data>::SoA && ComponentLayout<Movement_data>::SoA, "Hot components opt in to SoA");
+    static_assert(!ComponentLayout<Identity_data>::SoA, "Other components stay AoS");
+
+    {
+        // Integrate: AoS reference loop vs SoA lanes (odd count exercises the scalar tail)
+        const EntityID count = 1003;
+        const float dt = 0.0166666f;
+
+        ComponentPool<Position_data> aosPositions;
+        ComponentPool<Movement_data> aosMovements;
+        ComponentPool<Position_data> soaPositions;
+        ComponentPool<Movement_data> soaMovements;
+        SoALanes<Position_data> positionLanes;
+        SoALanes<Movement_data> movementLanes;
+        EntitySet entities;
+
+        for (EntityID e = 1; e <= count; ++e)
+        {
+            Position_data pos(Vector(NextFloat(5000.0f), NextFloat(5000.0f), NextFloat(10.0f)));
+            Movement_data move;
+            move.velocity = Vector(NextFloat(300.0f), NextFloat(300.0f), NextFloat(1.0f));
+            // Entities are inserted in reverse so view order differs from pool order
+            const EntityID entity = count + 1 - e;
+            aosPositions.AddComponent(entity, pos);
+            aosMovements.AddComponent(entity, move);
+            soaPositions.AddComponent(entity, pos);
+            soaMovements.AddComponent(entity, move);
+            entities.insert(e);
+        }
+
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            ComponentView<Position_data, Movement_data> aosView(entities, &aosPositions, &aosMovements);
+            aosView.Each([dt](EntityID, Position_data& pos, Movement_data& move) { pos.position += move.velocity * dt; });
+
+            positionLanes.Resize(entities.size());
+            movementLanes.Resize(entities.size());
+            ComponentView<Position_data, Movement_data> soaView(entities, &soaPositions, &soaMovements);
+            soaView.ParallelForChunks([&](size_t begin, size_t end)
+                {
+                    positionLanes.Gather(soaPositions, entities.data(), begin, end);
+                    movementLanes.Gather(soaMovements, entities.data(), begin, end);
+                    for (size_t lane = 0; lane < 3; ++lane)
+                        SoAKernels::Integrate(positionLanes.Lane(lane), movementLanes.Lane(lane), dt, begin, end);
+                    positionLanes.Scatter(soaPositions, begin, end);
+                }, 64);
+        }
+
+        bool identical = true;
+        for (EntityID e = 1; e <= count; ++e)
+        {
+            const Vector& a = aosPositions.GetComponent(e).position;
+            const Vector& b = soaPositions.GetComponent(e).position;
+            identical = identical && SameBits(a.x, b.x) && SameBits(a.y, b.y) && SameBits(a.z, b.z);
+        }
+        ok = AssertTrue(identical, "SoA integration is bit-identical to AoS") && ok;
+        ok = AssertTrue(SameBits(soaMovements.GetComponent(7).velocity.x, aosMovements.GetComponent(7).velocity.x), "Velocity untouched") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[ECSSoATest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,146 @@
+#include "../ECS_View.h"
+
+#include <iostream>
+#include <stdexcept>
+
+struct ViewTestPosition
+{
+    float x = 0.0f;
+
+    ViewTestPosition() = default;
+    explicit ViewTestPosition(float v) : x(v) {}
+};
+
+struct ViewTestVelocity
+{
+    float dx = 0.0f;
+
+    ViewTestVelocity() = default;
+    explicit ViewTestVelocity(float v) : dx(v) {}
+};
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[ECSViewTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        EntitySet set;
+        ok = AssertTrue(set.insert(1) && set.insert(2) && set.insert(3), "Insert three entities") && ok;
+        ok = AssertTrue(!set.insert(2), "Duplicate insert rejected") && ok;
+        ok = AssertTrue(set.size() == 3 && set.count(3) == 1, "Size and count") && ok;
+
+        ok = AssertTrue(set.erase(1) == 1 && set.erase(1) == 0, "Erase once") && ok;
+        ok = AssertTrue(set.size() == 2 && set[0] == 3 && set[1] == 2, "Swap-and-pop keeps set packed") && ok;
+        ok = AssertTrue(!set.contains(MakeEntityID(3, 1)), "Stale handle not contained") && ok;
+
+        set.clear();
+        ok = AssertTrue(set.empty() && !set.contains(2), "Clear") && ok;
+    }
+
+    {
+        // Erasing while iterating stops cleanly instead of reading past the end
+        EntitySet set;
+        for (EntityID e = 1; e <= 4; ++e)
+            set.insert(e);
+
+        int visited = 0;
+        for (EntityID e : set)
+        {
+            ++visited;
+            if (e == 1)
+            {
+                set.erase(3);
+                set.erase(4);
+            }
+        }
+        ok = AssertTrue(visited == 2, "Iteration tolerates erase during loop") && ok;
+    }
+
+    {
+        ComponentPool<ViewTestPosition> positions;
+        ComponentPool<ViewTestVelocity> velocities;
+        EntitySet matching;
+
+        for (EntityID e = 1; e <= 3; ++e)
+        {
+            positions.AddComponent(e, static_cast<float>(e));
+            velocities.AddComponent(e, 10.0f);
+            matching.insert(e);
+        }
+        // Entity 4 has only a position: not part of the view
+        positions.AddComponent(4, 4.0f);
+
+        ComponentView<ViewTestPosition, ViewTestVelocity> view(matching, &positions, &velocities);
+        view.Each([](EntityID, ViewTestPosition& pos, ViewTestVelocity& vel) { pos.x += vel.dx; });
+
+        ok = AssertTrue(view.size() == 3, "View size") && ok;
+        ok = AssertTrue(positions.GetComponent(1).x == 11.0f && positions.GetComponent(3).x == 13.0f, "Each updates matching entities") && ok;
+        ok = AssertTrue(positions.GetComponent(4).x == 4.0f, "Each skips non-matching entities") && ok;
+        ok = AssertTrue(view.Get<ViewTestVelocity>(2).dx == 10.0f, "Typed Get") && ok;
+    }
+
+    {
+        // ParallelForEach visits every entity exactly once, with or without workers
+        for (unsigned int workers = 0; workers <= 3; workers += 3)
+        {
+            if (workers > 0)
+                JobSystem::Get().Initialize(workers);
+
+            ComponentPool<ViewTestPosition> positions;
+            ComponentPool<ViewTestVelocity> velocities;
+            EntitySet matching;
+            const EntityID count = 5000;
+            for (EntityID e = 1; e <= count; ++e)
+            {
+                positions.AddComponent(e, static_cast<float>(e));
+                velocities.AddComponent(e, 0.5f);
+                matching.insert(e);
+            }
+
+            ComponentView<ViewTestPosition, ViewTestVelocity> view(matching, &positions, &velocities);
+            view.ParallelForEach([](EntityID, ViewTestPosition& pos, ViewTestVelocity& vel) { pos.x += vel.dx; }, 100);
+
+            bool allUpdated = true;
+            for (EntityID e = 1; e <= count; ++e)
+                allUpdated = allUpdated && positions.GetComponent(e).x == static_cast<float>(e) + 0.5f;
+            ok = AssertTrue(allUpdated, workers > 0 ? "ParallelForEach with workers" : "ParallelForEach without workers") && ok;
+
+            // A throwing chunk does not stall the caller: the exception comes back to it
+            bool rethrown = false;
+            try
+            {
+                view.ParallelForEach([](EntityID entity, ViewTestPosition& pos, ViewTestVelocity&)
+                    {
+                        if (entity % 1000 == 0)
+                            throw std::runtime_error("chunk failed");
+                        pos.x += 1.0f;
+                    }, 100);
+            }
+            catch (const std::runtime_error&)
+            {
+                rethrown = true;
+            }
+            ok = AssertTrue(rethrown, workers > 0 ? "Exception rethrown with workers" : "Exception rethrown without workers") && ok;
+
+            JobSystem::Get().Shutdown();
+        }
+    }
+
+    if (ok)
+    {
+        std::cout << "[ECSViewTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,257 @@
+#include "../Rendering/RenderQueue.h"
+#include "../Rendering/RenderScene.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+using Olympe::Rendering::DepthSortKey;
+using Olympe::Rendering::RenderItem;
+using Olympe::Rendering::RenderQueue;
+using Olympe::Rendering::RenderScene;
+using Olympe::Rendering::SceneSprite;
+using Olympe::Rendering::TileBatch;
+using Olympe::Rendering::TileBlock;
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[RenderQueueTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static void MakeBlock(TileBlock& block, uint32_t id, const std::vector<float>& batchDepths, bool flat)
+{
+    block.id = id;
+    block.revision = 1;
+    block.flat = flat;
+    block.batches.clear();
+    for (float depth : batchDepths)
+    {
+        TileBatch batch;
+        batch.depth = depth;
+        batch.quadCount = 1;
+        block.batches.push_back(batch);
+    }
+    block.minDepth = batchDepths.front();
+    block.maxDepth = batchDepths.back();
+}
+
+static std::vector<RenderItem> Drain(const RenderQueue& queue)
+{
+    std::vector<RenderItem> items;
+    queue.Visit([&](const RenderItem& item) { items.push_back(item); });
+    return items;
+}
+
+static bool IsDepthSorted(const std::vector<RenderItem>& items)
+{
+    for (size_t i = 1; i < items.size(); ++i)
+        if (items[i - 1].depth > items[i].depth)
+            return false;
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    {
+        // Key order matches float order, including negative depths
+        const float depths[] = { -20000.0f, -1000.5f, -1.0f, -0.25f, 0.0f, 0.1f, 1.0f, 99.5f, 100.0f, 10000.0f, 50000.0f };
+        bool monotonic = true;
+        for (size_t i = 1; i < sizeof(depths) / sizeof(depths[0]); ++i)
+            monotonic = monotonic && DepthSortKey(depths[i - 1]) < DepthSortKey(depths[i]);
+        ok = AssertTrue(monotonic, "Depth keys preserve order") && ok;
+    }
+
+    {
+        // Dynamic sort: insertion sort (short list) and radix sort (long list), both stable
+        const size_t counts[] = { 20, 3000 };
+        for (size_t count : counts)
+        {
+            RenderQueue queue;
+            std::vector<RenderItem> reference;
+            std::uint32_t seed = 12345u;
+            queue.ClearDynamic();
+            for (size_t i = 0; i < count; ++i)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                const float depth = static_cast<float>(static_cast<int>(seed >> 20) % 400 - 200) * 0.5f;
+                const RenderItem item = RenderItem::MakeEntity(depth, static_cast<EntityID>(i + 1));
+                queue.AddDynamic(item);
+                reference.push_back(item);
+            }
+            queue.SortDynamic();
+            std::stable_sort(reference.begin(), reference.end(),
+                [](const RenderItem& a, const RenderItem& b) { return a.depth < b.depth; });
+
+            bool same = queue.GetDynamicItems().size() == reference.size();
+            for (size_t i = 0; same && i < reference.size(); ++i)
+                same = queue.GetDynamicItems()[i].entity.entityId == reference[i].entity.entityId;
+            ok = AssertTrue(same, count > RenderQueue::INSERTION_SORT_THRESHOLD
+                                  ? "Radix sort matches stable sort" : "Insertion sort matches stable sort") && ok;
+        }
+    }
+
+    {
+        // Shared scene: sorted once (stable), then each view keeps a subset already in order
+        RenderScene scene;
+        std::uint32_t seed = 777u;
+        for (size_t i = 0; i < 500; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            SceneSprite sprite;
+            sprite.entity = static_cast<EntityID>(i + 1);
+            sprite.depth = static_cast<float>(static_cast<int>(seed >> 20) % 100 - 50);
+            sprite.key = DepthSortKey(sprite.depth);
+            scene.Add(sprite);
+        }
+        scene.Sort();
+
+        bool sorted = true;
+        const std::vector<SceneSprite>& sprites = scene.GetSprites();
+        for (size_t i = 1; i < sprites.size(); ++i)
+        {
+            sorted = sorted && (sprites[i - 1].depth < sprites[i].depth ||
+                                (sprites[i - 1].depth == sprites[i].depth && sprites[i - 1].entity < sprites[i].entity));
+        }
+        ok = AssertTrue(sprites.size() == 500 && sorted, "Scene sprites stable-sorted by depth") && ok;
+
+        // Two views culling different halves of the scene
+        for (EntityID parity = 0; parity < 2; ++parity)
+        {
+            RenderQueue view;
+            view.ClearDynamic();
+            for (const SceneSprite& sprite : sprites)
+            {
+                if (sprite.entity % 2 == parity)
+                    view.AddDynamic(RenderItem::MakeSprite(sprite));
+            }
+            std::vector<RenderItem> before = view.GetDynamicItems();
+            view.SortDynamic();
+
+            bool same = view.GetDynamicItems().size() == before.size() && before.size() == 250;
+            for (size_t i = 0; same && i < before.size(); ++i)
+            {
+                const RenderItem& item = view.GetDynamicItems()[i];
+                same = item.entity.sprite == before[i].entity.sprite &&
+                       item.entity.sprite->entity == item.entity.entityId &&
+                       item.key == item.entity.sprite->key;
+            }
+            ok = AssertTrue(same, "View subset of the scene needs no sort") && ok;
+        }
+    }
+
+    // Flat block A alone in [100, 150], non-flat block B in [200, 300],
+    // flat block C in [230, 245] overlapping B, background parallax layer
+    TileBlock blockA, blockB, blockC;
+    MakeBlock(blockA, 0, { 100.0f, 120.0f, 150.0f }, true);
+    MakeBlock(blockB, 1, { 200.0f, 240.0f, 300.0f }, false);
+    MakeBlock(blockC, 2, { 230.0f, 245.0f }, true);
+
+    RenderQueue queue;
+    auto submitStatic = [&](uint32_t generation)
+    {
+        queue.BeginStatic(generation);
+        queue.AddStaticItem(RenderItem::MakeParallax(-1000.0f, 0));
+        queue.AddStaticBlock(&blockA);
+        queue.AddStaticBlock(&blockB);
+        queue.AddStaticBlock(&blockC);
+        queue.EndStatic();
+    };
+
+    {
+        submitStatic(1);
+        queue.ClearDynamic();
+        queue.SortDynamic();
+        const std::vector<RenderItem> items = Drain(queue);
+
+        // Parallax + block A (collapsed) + 3 batches of B + 2 batches of C
+        ok = AssertTrue(items.size() == 7 && IsDepthSorted(items), "Static items sorted") && ok;
+        ok = AssertTrue(items[1].type == RenderItem::TileBlock && items[1].tiles.block == &blockA,
+                        "Flat block alone in its depth range is one item") && ok;
+        size_t blocksC = 0;
+        for (const RenderItem& item : items)
+            blocksC += (item.type == RenderItem::TileBlock && item.tiles.block == &blockC) ? 1 : 0;
+        ok = AssertTrue(blocksC == 0, "Flat block overlapping other tiles stays split") && ok;
+    }
+
+    {
+        // Same static set: reused; re-baked block or new geometry: rebuilt
+        const uint32_t rebuilds = queue.GetStaticRebuildCount();
+        submitStatic(1);
+        ok = AssertTrue(queue.GetStaticRebuildCount() == rebuilds, "Unchanged static set is not re-sorted") && ok;
+
+        ++blockB.revision;
+        submitStatic(1);
+        ok = AssertTrue(queue.GetStaticRebuildCount() == rebuilds + 1, "Re-baked block rebuilds the static list") && ok;
+
+        submitStatic(2);
+        ok = AssertTrue(queue.GetStaticRebuildCount() == rebuilds + 2, "New geometry rebuilds the static list") && ok;
+    }
+
+    {
+        // Entity inside block A's range: A is expanded and interleaved
+        queue.ClearDynamic();
+        queue.AddDynamic(RenderItem::MakeEntity(130.0f, 7));
+        queue.AddDynamic(RenderItem::MakeEntity(50.0f, 8));
+        queue.AddDynamic(RenderItem::MakeEntity(500.0f, 9));
+        queue.SortDynamic();
+        const std::vector<RenderItem> items = Drain(queue);
+
+        bool expanded = true;
+        for (const RenderItem& item : items)
+            expanded = expanded && item.type != RenderItem::TileBlock;
+        ok = AssertTrue(expanded && items.size() == 1 + 3 + 3 + 2 + 3, "Flat block with an entity inside is expanded") && ok;
+        ok = AssertTrue(IsDepthSorted(items), "Expanded block interleaves with entities") && ok;
+
+        // Entity on the block boundary also forces the expansion (range is inclusive)
+        queue.ClearDynamic();
+        queue.AddDynamic(RenderItem::MakeEntity(150.0f, 7));
+        queue.SortDynamic();
+        const std::vector<RenderItem> boundary = Drain(queue);
+        bool boundaryExpanded = true;
+        for (const RenderItem& item : boundary)
+            boundaryExpanded = boundaryExpanded && item.type != RenderItem::TileBlock;
+        ok = AssertTrue(boundaryExpanded && IsDepthSorted(boundary), "Entity on the block's max depth") && ok;
+    }
+
+    {
+        // Random entities: merge output stays sorted and complete
+        std::uint32_t seed = 99u;
+        queue.ClearDynamic();
+        for (int i = 0; i < 200; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            queue.AddDynamic(RenderItem::MakeEntity(static_cast<float>(seed % 1400) - 1100.0f, static_cast<EntityID>(i + 1)));
+        }
+        queue.SortDynamic();
+        const std::vector<RenderItem> items = Drain(queue);
+        size_t entities = 0;
+        size_t tileBatches = 0;
+        for (const RenderItem& item : items)
+        {
+            entities += item.type == RenderItem::Entity ? 1 : 0;
+            tileBatches += item.type == RenderItem::TileBatch ? 1 : 0;
+            tileBatches += item.type == RenderItem::TileBlock ? item.tiles.block->batches.size() : 0;
+        }
+        ok = AssertTrue(IsDepthSorted(items) && entities == 200 && tileBatches == 8, "Random merge is sorted and complete") && ok;
+    }
+
+    {
+        queue.Clear();
+        ok = AssertTrue(Drain(queue).empty() && queue.GetStaticItems().empty(), "Cleared queue") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[RenderQueueTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,148 @@
+// Split-screen rendering right after a level load: the first frame of every load prepares
+// two views in parallel, which must find the tile chunk index already rebuilt.
+// Headless (offscreen video driver + software renderer). Build it like RenderBenchmark:
+// console target with the engine sources minus OlympeEngine.cpp, run from the repository root.
+
+#include "../World.h"
+#include "../GameEngine.h"
+#include "../DataManager.h"
+#include "../ECS_Systems.h"
+#include "../ECS_Components.h"
+#include "../system/ViewportManager.h"
+#include "../system/JobSystem.h"
+
+#include <SDL3/SDL.h>
+#include <iostream>
+#include <vector>
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[RenderSplitScreenTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Two players side by side, as VideoGame lays them out
+static void SetupTwoViews()
+{
+    ViewportManager& viewports = ViewportManager::Get();
+    CameraSystem* cameras = World::Get().GetSystem<CameraSystem>();
+
+    const std::vector<short> previous = viewports.GetPlayers();
+    for (short playerID : previous)
+    {
+        viewports.RemovePlayer(playerID);
+        if (cameras) cameras->RemoveCameraForPlayer(playerID);
+    }
+    for (short playerID = 0; playerID < 2; ++playerID)
+    {
+        viewports.AddPlayer(playerID, ViewportLayout::ViewportLayout_Grid2x1);
+        if (cameras) cameras->CreateCameraForPlayer(playerID);
+    }
+}
+
+static bool LoadLevel(const char* mapPath)
+{
+    World& world = World::Get();
+    if (!world.LoadLevelFromTiled(mapPath))
+        return false;
+    while (world.IsDeferredLevelLoadingActive())
+        world.UpdateDeferredLevelLoading();
+    return true;
+}
+
+static void CenterCameras(const SDL_FRect& area)
+{
+    World& world = World::Get();
+    CameraSystem* cameras = world.GetSystem<CameraSystem>();
+    for (short playerID = 0; playerID < 2; ++playerID)
+    {
+        const EntityID camera = cameras->GetCameraEntityForPlayer(playerID);
+        if (camera == INVALID_ENTITY_ID)
+            continue;
+        Camera_data& cam = world.GetComponent<Camera_data>(camera);
+        cam.position = Vector(area.x + area.w * (0.25f + 0.5f * playerID), area.y + area.h * 0.5f, 0.f);
+    }
+}
+
+// First frame after a load, straight into two parallel views
+static bool RenderFirstFrame(const char* label)
+{
+    World& world = World::Get();
+    RenderingSystem* rendering = world.GetSystem<RenderingSystem>();
+    bool ok = true;
+
+    rendering->Render();
+    const RenderFrameMetrics& metrics = rendering->GetFrameMetrics();
+    ok = AssertTrue(metrics.viewCount == 2, label) && ok;
+    ok = AssertTrue(!world.GetTileChunks().empty() &&
+                    world.GetTileChunkIndex().GetChunkCount() == world.GetTileChunks().size(),
+                    "Chunk index rebuilt before the views") && ok;
+
+    // Same views looking at the map: both find their blocks through the index
+    CenterCameras(world.GetTileGeometry().GetWorldBounds());
+    rendering->Render();
+    ok = AssertTrue(rendering->GetFrameMetrics().visibleBlocks > 0, "Views see the map's blocks") && ok;
+    return ok;
+}
+
+int main()
+{
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    if (!SDL_Init(SDL_INIT_VIDEO))
+    {
+        std::cerr << "[RenderSplitScreenTest] Couldn't initialize SDL: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    const int width = 640;
+    const int height = 360;
+    SDL_Surface* surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    SDL_Renderer* renderer = surface ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (!renderer)
+    {
+        std::cerr << "[RenderSplitScreenTest] Couldn't create the software renderer: " << SDL_GetError() << std::endl;
+        if (surface) SDL_DestroySurface(surface);
+        SDL_Quit();
+        return 1;
+    }
+
+    GameEngine::screenWidth = width;
+    GameEngine::screenHeight = height;
+    GameEngine::renderer = renderer;
+    DataManager::Get().Initialize();
+    JobSystem::Get().Initialize();
+    ViewportManager::Get().Initialize(width, height);
+
+    bool ok = true;
+    const char* mapPath = "Gamedata/Levels/iso-test.tmj";
+    ok = AssertTrue(LoadLevel(mapPath), "Level loads") && ok;
+    SetupTwoViews();
+    ok = ok && RenderFirstFrame("First frame after the load renders two views");
+
+    // Every load marks the index dirty again
+    ok = AssertTrue(LoadLevel(mapPath), "Level reloads") && ok;
+    SetupTwoViews();
+    ok = ok && RenderFirstFrame("First frame after the reload renders two views");
+
+    World& world = World::Get();
+    world.UnloadCurrentLevel();
+    world.GetTileBlockCache().Clear();
+    DataManager::Get().UnloadAll();
+    JobSystem::Get().Shutdown();
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+    SDL_Quit();
+
+    if (!ok)
+    {
+        std::cerr << "[RenderSplitScreenTest] FAIL" << std::endl;
+        return 1;
+    }
+
+    std::cout << "[RenderSplitScreenTest] PASS" << std::endl;
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include "../StringAtom.h"
+#include "../ECS_Components.h"
+
+#include <iostream>
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[StringAtomTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+
+    const AtomID ui = InternAtom("UIElement");
+    const AtomID menu = InternAtom("MenuElement");
+
+    ok = AssertTrue(InternAtom("") == INVALID_ATOM, "Empty string is the invalid atom") && ok;
+    ok = AssertTrue(ui != INVALID_ATOM && menu != INVALID_ATOM && ui != menu, "Distinct strings get distinct atoms") && ok;
+    ok = AssertTrue(InternAtom(std::string("UI") + "Element") == ui, "Same string interns to the same atom") && ok;
+    ok = AssertTrue(InternAtom("uielement") != ui, "Atoms are case-sensitive") && ok;
+    ok = AssertTrue(AtomToString(menu) == "MenuElement", "Atom round-trip") && ok;
+    ok = AssertTrue(AtomToString(0xFFFFFFu).empty(), "Unknown atom maps to empty string") && ok;
+
+    // References returned by AtomToString stay valid while the table grows
+    const std::string& uiText = AtomToString(ui);
+    for (int i = 0; i < 1000; ++i)
+        InternAtom("Atom_" + std::to_string(i));
+    ok = AssertTrue(uiText == "UIElement", "String storage is stable") && ok;
+
+    // Default identities share the cached default atoms
+    const Identity_data identity;
+    ok = AssertTrue(identity.tagAtom == InternAtom("Untagged") && identity.typeAtom == InternAtom("UnknownType"),
+                    "Default identity atoms") && ok;
+    ok = AssertTrue(Identity_data().tagAtom == identity.tagAtom, "Default atoms are stable") && ok;
+
+    if (ok)
+    {
+        std::cout << "[StringAtomTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}
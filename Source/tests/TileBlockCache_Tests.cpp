@@ -0,0 +1,119 @@
+#include "../Rendering/TileBlockCache.h"
+#include "../TileChunkIndex.h"
+
+#include <SDL3/SDL.h>
+#include <iostream>
+#include <vector>
+
+using Olympe::Rendering::TileBlock;
+using Olympe::Rendering::TileBlockCache;
+using Olympe::Rendering::TileCameraKey;
+using Olympe::Rendering::TileGeometry;
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[TileBlockCacheTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static TileCameraKey MakeCamera(float zoom)
+{
+    TileCameraKey camera;
+    camera.zoom = zoom;
+    camera.viewportW = 320.0f;
+    camera.viewportH = 240.0f;
+    return camera;
+}
+
+int main()
+{
+    // Software renderer on a plain surface: no window, no video driver
+    SDL_Surface* surface = SDL_CreateSurface(320, 240, SDL_PIXELFORMAT_XRGB8888);
+    SDL_Renderer* renderer = surface ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    SDL_Texture* tileset = renderer ? SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, 16, 16) : nullptr;
+    if (!tileset)
+    {
+        std::cerr << "[TileBlockCacheTest] Couldn't create the software renderer: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    // One flat 16x16 block of 16x16 tiles
+    std::vector<TileChunk> chunks(1);
+    chunks[0].width = TileGeometry::BLOCK_SIZE;
+    chunks[0].height = TileGeometry::BLOCK_SIZE;
+    chunks[0].tileGIDs.assign(TileGeometry::BLOCK_SIZE * TileGeometry::BLOCK_SIZE, 1u);
+
+    TileGeometry geometry;
+    geometry.Build(chunks, Olympe::Rendering::TileMapOrientation::Orthogonal, 16, 16,
+        [tileset](uint32_t, SDL_Texture*& texture, SDL_Rect& srcRect, int& offsetX, int& offsetY) {
+            texture = tileset;
+            srcRect = SDL_Rect{ 0, 0, 16, 16 };
+            offsetX = 0;
+            offsetY = 0;
+            return true;
+        },
+        [](int worldX, int worldY, int zOrder) { return static_cast<float>(zOrder * 1000 + worldY + worldX); });
+
+    TileChunkIndex index;
+    index.Build(chunks);
+    TileRect everything;
+    everything.minX = 0;
+    everything.minY = 0;
+    everything.maxX = TileGeometry::BLOCK_SIZE - 1;
+    everything.maxY = TileGeometry::BLOCK_SIZE - 1;
+    std::vector<TileBlock*> blocks;
+    std::vector<uint32_t> scratch;
+    geometry.CollectVisibleBlocks(index, everything, blocks, scratch);
+
+    bool ok = AssertTrue(blocks.size() == 1 && blocks[0]->flat, "One flat block");
+    if (ok)
+    {
+        TileBlock& block = *blocks[0];
+
+        {
+            // One view zooming: every request changes the zoom, nothing is cached
+            TileBlockCache cache;
+            bool drawn = false;
+            for (int frame = 0; frame < 8; ++frame)
+                drawn = cache.Draw(renderer, geometry, block, 0, MakeCamera(frame % 2 ? 1.0f : 2.0f)) || drawn;
+            ok = AssertTrue(!drawn && cache.GetTextureCount() == 0, "Zoom animation is not cached") && ok;
+            cache.Clear();
+        }
+
+        {
+            // Two split-screen views at different zooms, drawn alternately every frame
+            TileBlockCache cache;
+            bool firstFrameCached = false;
+            bool laterFramesCached = true;
+            for (int frame = 0; frame < 4; ++frame)
+            {
+                const bool view0 = cache.Draw(renderer, geometry, block, 0, MakeCamera(1.0f));
+                const bool view1 = cache.Draw(renderer, geometry, block, 1, MakeCamera(2.0f));
+                if (frame == 0)
+                    firstFrameCached = view0 || view1;
+                else
+                    laterFramesCached = laterFramesCached && view0 && view1;
+            }
+            ok = AssertTrue(!firstFrameCached, "Each zoom waits for a second request") && ok;
+            ok = AssertTrue(laterFramesCached && cache.GetTextureCount() == 2, "Both views' zooms are cached") && ok;
+            cache.Clear();
+        }
+    }
+
+    SDL_DestroyTexture(tileset);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+
+    if (!ok)
+    {
+        std::cerr << "[TileBlockCacheTest] FAIL" << std::endl;
+        return 1;
+    }
+
+    std::cout << "[TileBlockCacheTest] PASS" << std::endl;
+    return 0;
+}
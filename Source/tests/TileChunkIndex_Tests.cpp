@@ -0,0 +1,129 @@
+#include "../TileChunkIndex.h"
+
+#include <iostream>
+#include <set>
+#include <utility>
+
+static bool AssertTrue(bool condition, const char* label)
+{
+    if (!condition)
+    {
+        std::cerr << "[TileChunkIndexTest] FAILED: " << label << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static TileChunk MakeChunk(int x, int y, int w, int h, int zOrder)
+{
+    TileChunk chunk;
+    chunk.x = x;
+    chunk.y = y;
+    chunk.width = w;
+    chunk.height = h;
+    chunk.zOrder = zOrder;
+    chunk.tileGIDs.assign(static_cast<size_t>(w * h), 1u);
+    return chunk;
+}
+
+// Visible (layer, worldX, worldY) triples, by query and by brute force
+typedef std::set<std::pair<int, std::pair<int, int>>> TileSet;
+
+static TileSet QueryTiles(const TileChunkIndex& index, const TileRect& range)
+{
+    TileSet tiles;
+    index.Query(range, [&](const TileChunk& chunk, const TileRect& local)
+        {
+            for (int y = local.minY; y <= local.maxY; ++y)
+                for (int x = local.minX; x <= local.maxX; ++x)
+                    tiles.insert(std::make_pair(chunk.zOrder, std::make_pair(chunk.x + x, chunk.y + y)));
+        });
+    return tiles;
+}
+
+static TileSet BruteForceTiles(const std::vector<TileChunk>& chunks, const TileRect& range)
+{
+    TileSet tiles;
+    for (const TileChunk& chunk : chunks)
+        for (int y = 0; y < chunk.height; ++y)
+            for (int x = 0; x < chunk.width; ++x)
+            {
+                const int wx = chunk.x + x;
+                const int wy = chunk.y + y;
+                if (wx >= range.minX && wx <= range.maxX && wy >= range.minY && wy <= range.maxY)
+                    tiles.insert(std::make_pair(chunk.zOrder, std::make_pair(wx, wy)));
+            }
+    return tiles;
+}
+
+int main()
+{
+    bool ok = true;
+
+    // Infinite map: two layers of 16x16 chunks around the origin (negative coordinates)
+    // plus a finite-style single large chunk on a third layer
+    std::vector<TileChunk> chunks;
+    for (int layer = 0; layer < 2; ++layer)
+        for (int cy = -4; cy < 4; ++cy)
+            for (int cx = -4; cx < 4; ++cx)
+                chunks.push_back(MakeChunk(cx * 16, cy * 16, 16, 16, layer));
+    chunks.push_back(MakeChunk(-20, -10, 70, 45, 2));
+
+    TileChunkIndex index;
+    index.Build(chunks);
+    ok = AssertTrue(index.GetChunkCount() == chunks.size(), "Chunk count") && ok;
+
+    {
+        TileRect range;
+        range.minX = -7; range.minY = 3; range.maxX = 21; range.maxY = 40;
+        ok = AssertTrue(QueryTiles(index, range) == BruteForceTiles(chunks, range), "Query matches brute force") && ok;
+
+        std::vector<uint32_t> visible;
+        index.CollectChunks(range, visible);
+        // Layer chunks overlapping x [-16, 31] and y [0, 47]: 3 columns x 3 rows per layer, plus the big chunk
+        ok = AssertTrue(visible.size() == 2 * 9 + 1, "Whole chunks outside the range are rejected") && ok;
+        bool ascending = true;
+        for (size_t i = 1; i < visible.size(); ++i)
+            ascending = ascending && visible[i - 1] < visible[i];
+        ok = AssertTrue(ascending, "Chunks are reported once, in list order") && ok;
+    }
+
+    {
+        // Random ranges, including ones partly or fully outside the map
+        bool allMatch = true;
+        std::uint32_t seed = 777u;
+        for (int i = 0; i < 300; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int x = static_cast<int>(seed >> 8) % 200 - 100;
+            const int y = static_cast<int>(seed >> 16) % 200 - 100;
+            TileRect range;
+            range.minX = x; range.minY = y;
+            range.maxX = x + static_cast<int>(seed % 60); range.maxY = y + static_cast<int>((seed >> 4) % 40);
+            allMatch = allMatch && QueryTiles(index, range) == BruteForceTiles(chunks, range);
+        }
+        ok = AssertTrue(allMatch, "Random queries match brute force") && ok;
+    }
+
+    {
+        TileRect outside;
+        outside.minX = 1000; outside.minY = 1000; outside.maxX = 1010; outside.maxY = 1010;
+        ok = AssertTrue(QueryTiles(index, outside).empty(), "Range outside the map") && ok;
+
+        TileRect empty;
+        ok = AssertTrue(empty.IsEmpty() && QueryTiles(index, empty).empty(), "Empty range") && ok;
+
+        index.Clear();
+        TileRect all;
+        all.minX = -100; all.minY = -100; all.maxX = 100; all.maxY = 100;
+        ok = AssertTrue(index.GetChunkCount() == 0 && QueryTiles(index, all).empty(), "Cleared index") && ok;
+    }
+
+    if (ok)
+    {
+        std::cout << "[TileChunkIndexTest] PASS" << std::endl;
+        return 0;
+    }
+
+    return 1;
+}